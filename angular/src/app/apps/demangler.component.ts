@@ -26,7 +26,8 @@ import { SpinnerLoadingComponent } from '../templates/spinner-loading.component'
 import { TextareaTwoComponent } from '../templates/textarea-two.component';
 import { WasmLoaderDemanglerService } from '../wasm-loader-demangler.service';
 import { WasmLoaderFormatterService } from '../wasm-loader-formatter.service';
-import { assertError } from './shared/interfaces/errors.js';
+import { WasmWorkerService } from '../wasm-worker.service';
+import { assertError, isCancelError } from './shared/interfaces/errors.js';
 
 @Component({
   selector: 'app-demangler',
@@ -55,9 +56,9 @@ export class AppDemanglerComponent implements OnInit {
 
   formatStyle?: FormatStyle;
   protected emptyStyle?: FormatStyle;
+  // YAML of formatStyle sent to the worker, updated by reformat().
+  private formatStyleYaml?: string;
 
-  // Text by pending if text insert while wasm is loading.
-  private pendingText = false;
   protected titleLoading = '';
 
   private readonly newStyle = viewChild.required<ElementRef<HTMLSelectElement>>('newStyle');
@@ -74,6 +75,7 @@ export class AppDemanglerComponent implements OnInit {
   private readonly cdr = inject(ChangeDetectorRef);
   private readonly wasmLoaderDemangler = inject(WasmLoaderDemanglerService);
   private readonly wasmLoaderFormatter = inject(WasmLoaderFormatterService);
+  private readonly wasmWorker = inject(WasmWorkerService);
 
   constructor() {
     this.demangle = this.demangle.bind(this);
@@ -82,8 +84,6 @@ export class AppDemanglerComponent implements OnInit {
   async ngOnInit() {
     this.updateIconSize();
 
-    await this.loadWasmDemanglerModule();
-
     const enableClangFormat = localStorage.getItem('enableClangFormat');
     if (enableClangFormat) {
       this.enableClangFormat = enableClangFormat === 'true';
@@ -96,6 +96,7 @@ export class AppDemanglerComponent implements OnInit {
       localStorage.getItem('enableClangFormatExpert') === 'true';
   }
 
+  // Only the ELF loading demangles on the main thread.
   async loadWasmDemanglerModule() {
     this.demangler ??= await this.wasmLoaderDemangler.wasm();
   }
@@ -126,12 +127,6 @@ export class AppDemanglerComponent implements OnInit {
       this.formatStyle = this.formatter.getMozillaStyle();
     }
     this.emptyStyle = this.formatter.getNoStyle();
-
-    if (this.pendingText) {
-      const event = new Event('input', { bubbles: true });
-      this.textareaTwo().inputElement().nativeElement.dispatchEvent(event);
-    }
-    this.pendingText = false;
   }
 
   private updateIconSize() {
@@ -182,24 +177,48 @@ export class AppDemanglerComponent implements OnInit {
   }
 
   protected async demangle(mangledName: string): Promise<string> {
-    await this.loadWasmDemanglerModule();
     if (this.enableClangFormat) {
       await this.loadWasmFormatterModule();
     }
-    if (this.demangler) {
-      const lines = mangledName.split('\n');
-      let demangledNameList = lines.map((line) =>
-        this.demangler!.web_demangle(line.trim())
-      );
+    // Only the last input is shown: stop the job of the previous one.
+    this.wasmWorker.cancel();
+    try {
       if (this.enableClangFormat && this.formatter && this.formatStyle) {
-        demangledNameList = demangledNameList.map((line) =>
-          this.formatter!.formatter(line, this.formatStyle!)
+        const [demangledNames] = await this.wasmWorker.run(
+          'demangleAndFormat',
+          [mangledName],
+          {
+            style: (this.formatStyleYaml ??= this.formatter.serializeToYaml(
+              this.formatStyle
+            )),
+          }
         );
+        return demangledNames;
       }
-      return demangledNameList.join('\n');
-    } else {
-      this.pendingText = true;
-      return '';
+      const lines = mangledName.split('\n').map((line) => line.trim());
+      return (await this.wasmWorker.run('demangle', lines)).join('\n');
+    } catch (error) {
+      if (isCancelError(error)) {
+        return '';
+      }
+      throw error;
+    }
+  }
+
+  protected async loadElfFromFile(event: Event) {
+    const input = event.currentTarget as HTMLInputElement;
+    const buffer = await input.files!.item(0)!.arrayBuffer();
+    input.value = '';
+    await this.loadWasmDemanglerModule();
+    try {
+      this.textareaTwo().setOutput(
+        Promise.resolve(this.demangler!.web_demangle_elf(new Uint8Array(buffer)))
+      );
+    } catch (error) {
+      console.error(error);
+      this.textareaTwo().setOutput(
+        Promise.resolve('Failed to read symbols: not an ELF object or archive.')
+      );
     }
   }
 
@@ -240,13 +259,11 @@ export class AppDemanglerComponent implements OnInit {
   }
 
   protected reformat() {
+    this.formatStyleYaml = this.formatter!.serializeToYaml(this.formatStyle!);
+    localStorage.setItem('formatStyle', this.formatStyleYaml);
+
     const event = new Event('input', { bubbles: true });
     this.textareaTwo().inputElement().nativeElement.dispatchEvent(event);
-
-    localStorage.setItem(
-      'formatStyle',
-      this.formatter!.serializeToYaml(this.formatStyle!)
-    );
   }
 
   protected readonly isLoading = computed(() => {
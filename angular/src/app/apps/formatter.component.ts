@@ -24,7 +24,8 @@ import { DialogPopupComponent } from '../templates/dialog-popup.component';
 import { SpinnerLoadingComponent } from '../templates/spinner-loading.component';
 import { TextareaTwoComponent } from '../templates/textarea-two.component';
 import { WasmLoaderFormatterService } from '../wasm-loader-formatter.service';
-import { assertError } from './shared/interfaces/errors.js';
+import { WasmWorkerService } from '../wasm-worker.service';
+import { assertError, isCancelError } from './shared/interfaces/errors.js';
 
 @Component({
   selector: 'app-formatter',
@@ -51,6 +52,8 @@ export class AppFormatterComponent implements OnInit {
 
   protected formatStyle?: FormatStyle;
   protected emptyStyle?: FormatStyle;
+  // YAML of formatStyle sent to the worker, updated by reformat().
+  private formatStyleYaml?: string;
 
   // Text by pending if text insert while wasm is loading.
   private pendingText = false;
@@ -68,6 +71,7 @@ export class AppFormatterComponent implements OnInit {
   }
 
   private readonly wasmLoaderFormatter = inject(WasmLoaderFormatterService);
+  private readonly wasmWorker = inject(WasmWorkerService);
   private readonly cdr = inject(ChangeDetectorRef);
 
   constructor(
@@ -154,11 +158,21 @@ export class AppFormatterComponent implements OnInit {
   protected async format(mangledName: string): Promise<string> {
     await this.loadWasmFormatterModule();
     if (this.formatter) {
-      const demangledName = this.formatter.formatter(
-        mangledName,
-        this.formatStyle!
-      );
-      return demangledName;
+      // Only the last input is shown: stop the job of the previous one.
+      this.wasmWorker.cancel();
+      try {
+        const [formatted] = await this.wasmWorker.run('format', [mangledName], {
+          style: (this.formatStyleYaml ??= this.formatter.serializeToYaml(
+            this.formatStyle!
+          )),
+        });
+        return formatted;
+      } catch (error) {
+        if (isCancelError(error)) {
+          return '';
+        }
+        throw error;
+      }
     } else {
       this.pendingText = true;
       return '';
@@ -202,13 +216,11 @@ export class AppFormatterComponent implements OnInit {
   }
 
   protected reformat() {
+    this.formatStyleYaml = this.formatter!.serializeToYaml(this.formatStyle!);
+    localStorage.setItem('formatStyle', this.formatStyleYaml);
+
     const event = new Event('input', { bubbles: true });
     this.textareaTwo().inputElement().nativeElement.dispatchEvent(event);
-
-    localStorage.setItem(
-      'formatStyle',
-      this.formatter!.serializeToYaml(this.formatStyle!)
-    );
   }
 
   protected readonly isLoading = computed(() => {
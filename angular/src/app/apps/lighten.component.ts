@@ -2,11 +2,11 @@ import { ChangeDetectionStrategy, Component, inject, OnInit, viewChild } from '@
 import { FormsModule } from '@angular/forms';
 import { LucideAngularModule } from 'lucide-angular';
 
-import { EmbindModule as LightenModule } from '../../assets/web_lighten.js';
 import { GithubMarkInlineComponent } from '../img/github-mark-inline.component.js';
 import { DialogPopupComponent } from '../templates/dialog-popup.component';
 import { TextareaTwoComponent } from '../templates/textarea-two.component';
-import { WasmLoaderLightenService } from '../wasm-loader-lighten.service';
+import { WasmWorkerService } from '../wasm-worker.service';
+import { isCancelError } from './shared/interfaces/errors';
 
 @Component({
   selector: 'app-lighten',
@@ -22,11 +22,9 @@ import { WasmLoaderLightenService } from '../wasm-loader-lighten.service';
   changeDetection: ChangeDetectionStrategy.OnPush,
 })
 export class AppLightenComponent implements OnInit {
-  private lighten?: LightenModule;
-
   private readonly textareaTwo = viewChild.required(TextareaTwoComponent);
 
-  private readonly wasmLoaderLighten = inject(WasmLoaderLightenService);
+  private readonly wasmWorker = inject(WasmWorkerService);
 
   protected count = 4;
 
@@ -34,53 +32,30 @@ export class AppLightenComponent implements OnInit {
     this.lightenNumber = this.lightenNumber.bind(this);
   }
 
-  async ngOnInit() {
+  ngOnInit() {
     const count = localStorage.getItem('lighten-count');
     if (count) {
       this.count = Number(count);
     }
-
-    await this.loadWasmLightenModule();
-  }
-
-  async loadWasmLightenModule() {
-    this.lighten ??= await this.wasmLoaderLighten.wasm();
   }
 
-  private roundNumbers = (data: any): any => {
-    if (typeof data === 'number') {
-      return Number(
-        this.lighten!.web_lighten_number(data.toString(), this.count)
-      );
-    } else if (Array.isArray(data)) {
-      return data.map(this.roundNumbers);
-    } else if (typeof data === 'object' && data !== null) {
-      const roundedObject: any = {};
-      for (const key in data) {
-        if (data.hasOwnProperty(key)) {
-          roundedObject[key] = this.roundNumbers(data[key]);
-        }
-      }
-      return roundedObject;
-    }
-    return data;
-  }
-
-  private processJson(input: string): string {
+  protected async lightenNumber(input: string): Promise<string> {
+    // Only the last input is shown: stop the job of the previous one.
+    this.wasmWorker.cancel();
     try {
-      const parsedJson = JSON.parse(input);
-      const roundedJson = this.roundNumbers(parsedJson);
-      return JSON.stringify(roundedJson, null, 2);
+      const [output] = await this.wasmWorker.run('lightenJson', [input], {
+        size: this.count,
+      });
+      return output;
     } catch (error) {
+      if (isCancelError(error)) {
+        return '';
+      }
       console.error(error);
-      return 'Invalid JSON input';
+      return 'Invalid count';
     }
   }
 
-  protected lightenNumber(input: string): Promise<string> {
-    return Promise.resolve(this.processJson(input));
-  }
-
   protected onCount(count: number) {
     this.count = count;
 
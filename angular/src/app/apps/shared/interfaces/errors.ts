@@ -13,3 +13,17 @@ export function unknownAssertError(msg: unknown) {
   error.name = 'AssertError';
   return error;
 }
+
+interface CancelError extends Error {
+  name: 'CancelError';
+}
+
+export function cancelError(msg: string) {
+  const error = new Error(msg) as CancelError;
+  error.name = 'CancelError';
+  return error;
+}
+
+export function isCancelError(error: unknown): error is CancelError {
+  return error instanceof Error && error.name === 'CancelError';
+}
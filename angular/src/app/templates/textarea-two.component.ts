@@ -1,5 +1,5 @@
 import { CommonModule } from '@angular/common';
-import { ChangeDetectionStrategy, Component, ElementRef, input, viewChild } from '@angular/core';
+import { ChangeDetectionStrategy, ChangeDetectorRef, Component, ElementRef, inject, input, viewChild } from '@angular/core';
 
 @Component({
   selector: 'app-textarea-two',
@@ -17,7 +17,14 @@ export class TextareaTwoComponent {
 
   protected outputStr: Promise<string> = Promise.resolve('');
 
+  private readonly cdr = inject(ChangeDetectorRef);
+
   inputToOutput(inputStr: string) {
     this.outputStr = this.inputChange()(inputStr);
   }
+
+  setOutput(outputStr: Promise<string>) {
+    this.outputStr = outputStr;
+    this.cdr.markForCheck();
+  }
 }
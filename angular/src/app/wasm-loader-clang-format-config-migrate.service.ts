@@ -1,39 +1,23 @@
-import { Injectable, signal } from '@angular/core';
+import { Injectable } from '@angular/core';
 
 import { EmbindModule as ClangFormatConfigMigrateModule } from '../assets/web_clang_format_config_migrate';
-import web_clang_format_config_migrate from '../assets/web_clang_format_config_migrate.js';
-import { unknownAssertError } from './apps/shared/interfaces/errors';
+import { WasmLoader } from './wasm-loader';
 
 @Injectable({
   providedIn: 'root',
 })
-export class WasmLoaderClangFormatConfigMigrateService {
-  private instance?: ClangFormatConfigMigrateModule;
-
-  private readonly loading = signal(true);
-  readonly isLoading = this.loading.asReadonly();
-
+export class WasmLoaderClangFormatConfigMigrateService extends WasmLoader<ClangFormatConfigMigrateModule> {
   constructor() {
-    web_clang_format_config_migrate().then((instance: ClangFormatConfigMigrateModule) => {
-      this.instance = instance;
-      this.loading.set(false);
-    }).catch((err: unknown) => {
-      throw unknownAssertError(err);
+    /*
+     * The module embeds the parsers of every clang-format version. Import it
+     * on the first call so it gets its own chunk and is only downloaded when
+     * the migrate page needs it.
+     */
+    super(async () => {
+      const factory = await import(
+        '../assets/web_clang_format_config_migrate.js'
+      );
+      return factory.default();
     });
   }
-
-  async wasm(): Promise<ClangFormatConfigMigrateModule> {
-    if (this.isLoading()) {
-      await new Promise<void>((resolve) => {
-        const interval = setInterval(() => {
-          if (!this.isLoading()) {
-            clearInterval(interval);
-            resolve();
-          }
-        }, 50);
-      });
-    }
-
-    return this.instance!;
-  }
 }
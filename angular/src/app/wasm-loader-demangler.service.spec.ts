@@ -38,4 +38,30 @@ describe('WasmLoaderDemanglerService', () => {
       'std::__2::vector<clang::tooling::IncludeStyle::IncludeCategory, std::__2::allocator<clang::tooling::IncludeStyle::IncludeCategory>>'
     );
   });
+
+  it('check structured demangler', async () => {
+    const demangler: DemanglerModule = await service.wasm();
+
+    expect(
+      JSON.parse(demangler.web_demangle_json('_ZN1A1fIiEEvRKT_\n_ZTI1Y'))
+    ).toEqual([
+      {
+        mangled: '_ZN1A1fIiEEvRKT_',
+        demangled: 'void A::f<int>(int const&)',
+        kind: 'function',
+        scope: ['A'],
+        name: 'f',
+        template_args: ['int'],
+        params: ['int const&'],
+        return_type: 'void',
+        qualifiers: [],
+        ref_qualifier: '',
+      },
+      {
+        mangled: '_ZTI1Y',
+        demangled: 'typeinfo for Y',
+        kind: 'special',
+      },
+    ]);
+  });
 });
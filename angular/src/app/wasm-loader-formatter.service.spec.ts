@@ -28,4 +28,16 @@ describe('WasmLoaderFormatterService', () => {
   int b;
 }`);
   });
+
+  it('check demangleAndFormat', async () => {
+    const formatter: FormatterModule = await service.wasm();
+
+    const llvmStyle: FormatStyle = formatter.getLLVMStyle();
+    expect(
+      formatter.demangleAndFormat('_ZTI1Y\n_ZN1BD1Ev\n\n_ZN1A1fEic', llvmStyle)
+    ).toEqual(`typeinfo for Y
+B::~B()
+
+A::f(int, char)`);
+  });
 });
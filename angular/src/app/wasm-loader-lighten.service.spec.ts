@@ -104,4 +104,80 @@ describe('WasmLoaderLightenService', () => {
       '-1200000000'
     );
   });
+
+  it('check lighten json', async () => {
+    const lighten: LightenModule = await service.wasm();
+
+    expect(
+      lighten.web_lighten_json(
+        '{\n  "a": [0.30000000000000004, -1.19999165],\n  "1.10000165": "0.99999"\n}',
+        4
+      )
+    ).toEqual('{\n  "a": [0.3, -1.2],\n  "1.10000165": "0.99999"\n}');
+  });
+
+  it('check lighten csv', async () => {
+    const lighten: LightenModule = await service.wasm();
+
+    const sizes = new lighten.SizeList();
+    sizes.push_back(0);
+    sizes.push_back(4);
+    const lightener = new lighten.CsvLightener(','.charCodeAt(0), sizes, 0);
+    let output = lightener.feed('a,b\n1.10000165,1.1');
+    output += lightener.feed('0000165\n0.1,0.99999');
+    output += lightener.finish();
+    lightener.delete();
+    sizes.delete();
+
+    expect(output).toEqual('a,b\n1.10000165,1.1\n0.1,1');
+  });
+
+  it('check lighten strategies', async () => {
+    const lighten: LightenModule = await service.wasm();
+
+    const numbers = '0.30000000000000004\n1.19999165\n3.14159265';
+    const newline = '\n'.charCodeAt(0);
+    expect(
+      lighten.web_lighten_batch(numbers, newline, lighten.Strategy.Runs, 4)
+    ).toEqual('0.3\n1.2\n3.14159265');
+    expect(
+      lighten.web_lighten_batch(
+        numbers,
+        newline,
+        lighten.Strategy.ShortestFloat,
+        0
+      )
+    ).toEqual('0.3\n1.1999917\n3.1415927');
+    expect(
+      lighten.web_lighten_batch(numbers, newline, lighten.Strategy.Precision, 3)
+    ).toEqual('0.3\n1.2\n3.14');
+  });
+
+  it('check lighten typed arrays', async () => {
+    const lighten: LightenModule = await service.wasm();
+
+    expect(
+      lighten.web_lighten_float64_array(
+        new Float64Array([0.1 + 0.2, 1.19999165, -999999]),
+        lighten.Strategy.Runs,
+        4
+      )
+    ).toEqual(new Float64Array([0.3, 1.2, -1000000]));
+    expect(
+      lighten.web_lighten_float32_array(
+        new Float32Array([0.1, 3.14159265]),
+        lighten.Strategy.Precision,
+        3
+      )
+    ).toEqual(new Float32Array([0.1, 3.14]));
+
+    const packed = lighten.web_lighten_packed(
+      '1.10000165x0.999999-5',
+      new Uint32Array([0, 10, 11, 19, 21]),
+      lighten.Strategy.Runs,
+      4
+    );
+    expect(packed.text).toEqual('1.1x1-5');
+    expect(packed.offsets).toEqual(new Uint32Array([0, 3, 4, 5, 7]));
+  });
 });
@@ -1,39 +1,17 @@
-import { Injectable, signal } from '@angular/core';
+import { Injectable } from '@angular/core';
 
 import { EmbindModule as LightenModule } from '../assets/web_lighten';
 import web_lighten from '../assets/web_lighten.js';
-import { unknownAssertError } from './apps/shared/interfaces/errors';
+import { WasmLoader } from './wasm-loader';
 
 @Injectable({
   providedIn: 'root',
 })
-export class WasmLoaderLightenService {
-  private instance?: LightenModule;
-
-  private readonly loading = signal(true);
-  readonly isLoading = this.loading.asReadonly();
-
+export class WasmLoaderLightenService extends WasmLoader<LightenModule> {
   constructor() {
-    web_lighten().then((instance: LightenModule) => {
-      this.instance = instance;
-      this.loading.set(false);
-    }).catch((err: unknown) => {
-      throw unknownAssertError(err);
+    super(web_lighten);
+    this.wasm().catch((err: unknown) => {
+      console.error(err);
     });
   }
-
-  async wasm(): Promise<LightenModule> {
-    if (this.isLoading()) {
-      await new Promise<void>((resolve) => {
-        const interval = setInterval(() => {
-          if (!this.isLoading()) {
-            clearInterval(interval);
-            resolve();
-          }
-        }, 50);
-      });
-    }
-
-    return this.instance!;
-  }
 }
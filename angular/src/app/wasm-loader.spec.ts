@@ -0,0 +1,31 @@
+import { WasmLoader } from './wasm-loader';
+
+describe('WasmLoader', () => {
+  it('should share the load in progress', async () => {
+    let calls = 0;
+    const loader = new WasmLoader(() => {
+      calls += 1;
+      return Promise.resolve(calls);
+    });
+
+    const loads = Promise.all([loader.wasm(), loader.wasm()]);
+    expect(loader.isLoading()).toBe(true);
+    expect(await loads).toEqual([1, 1]);
+    expect(loader.isLoading()).toBe(false);
+    expect(await loader.wasm()).toBe(1);
+    expect(calls).toBe(1);
+  });
+
+  it('should retry after a failure', async () => {
+    let calls = 0;
+    const loader = new WasmLoader(() => {
+      calls += 1;
+      return calls === 1
+        ? Promise.reject(new Error('network'))
+        : Promise.resolve(calls);
+    });
+
+    await expect(loader.wasm()).rejects.toThrow('network');
+    expect(await loader.wasm()).toBe(2);
+  });
+});
@@ -0,0 +1,36 @@
+import { signal } from '@angular/core';
+
+import { unknownAssertError } from './apps/shared/interfaces/errors';
+
+/*
+ * Instantiate an emscripten module once. Concurrent callers share the
+ * promise of the load in progress instead of polling isLoading.
+ *
+ * The glue compiles the .wasm with WebAssembly.instantiateStreaming, so it
+ * must be served as application/wasm (see public/.htaccess). The browser
+ * then keeps the compiled code in its cache for the next visits.
+ */
+export class WasmLoader<T> {
+  private instance?: Promise<T>;
+
+  private readonly loading = signal(false);
+  readonly isLoading = this.loading.asReadonly();
+
+  constructor(private readonly factory: () => Promise<T>) {}
+
+  wasm(): Promise<T> {
+    if (this.instance === undefined) {
+      this.loading.set(true);
+      this.instance = this.factory()
+        .catch((err: unknown) => {
+          // Allow the next call to retry.
+          this.instance = undefined;
+          throw unknownAssertError(err);
+        })
+        .finally(() => {
+          this.loading.set(false);
+        });
+    }
+    return this.instance;
+  }
+}
@@ -0,0 +1,66 @@
+/*
+ * Messages between WasmWorkerService and wasm.worker.ts. Every request is a
+ * batch: the items are packed in one UTF-8 buffer with their byte offsets,
+ * the layout of web_batch::run. Both buffers are transferred, not copied.
+ */
+export type WasmCommand =
+  | 'demangle'
+  | 'demangleAndFormat'
+  | 'format'
+  | 'lightenJson';
+
+export interface WasmBatch {
+  text: Uint8Array<ArrayBuffer>;
+  // count + 1 offsets in text.
+  offsets: Uint32Array<ArrayBuffer>;
+}
+
+export interface WasmOptions {
+  // YAML of the FormatStyle for format and demangleAndFormat.
+  style?: string;
+  // Number of significant digits for lightenJson.
+  size?: number;
+}
+
+export interface WasmRequest extends WasmBatch, WasmOptions {
+  id: number;
+  command: WasmCommand;
+}
+
+// Drop a job that hasn't started yet.
+export interface WasmCancel {
+  id: number;
+  cancel: true;
+}
+
+/*
+ * started is sent when the modules of the job are instantiated and its
+ * native call begins: from then on, only terminating the worker stops it.
+ */
+export type WasmResponse =
+  | (WasmBatch & { id: number })
+  | { id: number; error: string }
+  | { id: number; started: true };
+
+export function pack(items: readonly string[]): WasmBatch {
+  const encoder = new TextEncoder();
+  const encoded = items.map((item) => encoder.encode(item));
+  const offsets = new Uint32Array(encoded.length + 1);
+  encoded.forEach((bytes, i) => {
+    offsets[i + 1] = offsets[i] + bytes.length;
+  });
+  const text = new Uint8Array(offsets[encoded.length]);
+  encoded.forEach((bytes, i) => {
+    text.set(bytes, offsets[i]);
+  });
+  return { text, offsets };
+}
+
+export function unpack({ text, offsets }: WasmBatch): string[] {
+  const decoder = new TextDecoder();
+  const items: string[] = [];
+  for (let i = 0; i + 1 < offsets.length; i += 1) {
+    items.push(decoder.decode(text.subarray(offsets[i], offsets[i + 1])));
+  }
+  return items;
+}
@@ -0,0 +1,49 @@
+import { TestBed } from '@angular/core/testing';
+
+import { isCancelError } from './apps/shared/interfaces/errors';
+import { pack, unpack } from './wasm-worker-protocol';
+import { WasmWorkerService } from './wasm-worker.service';
+
+describe('WasmWorkerService', () => {
+  let service: WasmWorkerService;
+
+  beforeEach(() => {
+    TestBed.configureTestingModule({});
+    service = TestBed.inject(WasmWorkerService);
+  });
+
+  it('should pack and unpack', () => {
+    const items = ['_ZTI1Y', '', 'état', '_ZN1BD1Ev'];
+    const batch = pack(items);
+    expect(batch.offsets).toEqual(new Uint32Array([0, 6, 6, 11, 20]));
+    expect(unpack(batch)).toEqual(items);
+  });
+
+  it('check demangler', async () => {
+    expect(
+      await service.run('demangle', ['_ZTI1Y', '_ZN1BD1Ev', 'NotMangled'])
+    ).toEqual(['typeinfo for Y', 'B::~B()', 'NotMangled']);
+  }, 60000);
+
+  it('check lighten', async () => {
+    expect(
+      await service.run(
+        'lightenJson',
+        ['{"a": [0.30000000000000004, -1.19999165]}', '[]'],
+        { size: 4 }
+      )
+    ).toEqual(['{"a": [0.3, -1.2]}', '[]']);
+  }, 60000);
+
+  it('should cancel the jobs in progress', async () => {
+    const job = service.run('demangle', ['_ZTI1Y']);
+    service.cancel();
+    const error: unknown = await job.catch((err: unknown) => err);
+    expect(isCancelError(error)).toBe(true);
+
+    // The worker still loads the module of the canceled job.
+    expect(await service.run('demangle', ['_ZTI1Y'])).toEqual([
+      'typeinfo for Y',
+    ]);
+  }, 60000);
+});
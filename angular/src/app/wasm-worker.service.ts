@@ -0,0 +1,122 @@
+import { inject, Injectable, PendingTasks } from '@angular/core';
+
+import { assertError, cancelError } from './apps/shared/interfaces/errors';
+import {
+  pack,
+  unpack,
+  WasmBatch,
+  WasmCancel,
+  WasmCommand,
+  WasmOptions,
+  WasmRequest,
+  WasmResponse,
+} from './wasm-worker-protocol';
+
+interface Job {
+  resolve: (batch: WasmBatch) => void;
+  reject: (error: Error) => void;
+  // The modules are instantiated and the native call runs.
+  started: boolean;
+}
+
+/*
+ * Run the wasm modules in a Web Worker so big inputs don't freeze the UI.
+ * The worker is started on the first job and keeps its modules.
+ *
+ * The formatter pages still instantiate web_formatter on the main thread:
+ * the options dialog edits the embind FormatStyle directly. The worker gets
+ * the style as YAML and only parses it again when it changes.
+ */
+@Injectable({
+  providedIn: 'root',
+})
+export class WasmWorkerService {
+  private worker?: Worker;
+  private nextId = 0;
+  private readonly jobs = new Map<number, Job>();
+
+  private readonly pendingTasks = inject(PendingTasks);
+
+  // The job is a pending task so the application is stable only once the
+  // output is back.
+  run(
+    command: WasmCommand,
+    items: readonly string[],
+    options: WasmOptions = {}
+  ): Promise<string[]> {
+    return this.pendingTasks.run(async () => {
+      const batch = pack(items);
+      const id = this.nextId;
+      this.nextId += 1;
+      const result = await new Promise<WasmBatch>((resolve, reject) => {
+        this.jobs.set(id, { resolve, reject, started: false });
+        this.getWorker().postMessage(
+          { ...options, id, command, ...batch } satisfies WasmRequest,
+          [batch.text.buffer, batch.offsets.buffer]
+        );
+      });
+      return unpack(result);
+    });
+  }
+
+  /*
+   * Reject the jobs in progress. The jobs still waiting for their module are
+   * dropped by id, so the module keeps loading. The worker is only
+   * terminated if a native call is running: it can't be interrupted.
+   */
+  cancel() {
+    if ([...this.jobs.values()].some((job) => job.started)) {
+      this.worker?.terminate();
+      this.worker = undefined;
+    } else {
+      for (const id of this.jobs.keys()) {
+        this.worker?.postMessage({ id, cancel: true } satisfies WasmCancel);
+      }
+    }
+    this.rejectAll(cancelError('Canceled by a newer job.'));
+  }
+
+  private rejectAll(error: Error) {
+    for (const job of this.jobs.values()) {
+      job.reject(error);
+    }
+    this.jobs.clear();
+  }
+
+  private getWorker(): Worker {
+    if (this.worker === undefined) {
+      const worker = new Worker(new URL('./wasm.worker', import.meta.url), {
+        type: 'module',
+      });
+      worker.addEventListener(
+        'message',
+        (event: MessageEvent<WasmResponse>) => {
+          const job = this.jobs.get(event.data.id);
+          if (job === undefined) {
+            return;
+          }
+          if ('started' in event.data) {
+            job.started = true;
+            return;
+          }
+          this.jobs.delete(event.data.id);
+          if ('error' in event.data) {
+            job.reject(assertError(event.data.error));
+          } else {
+            job.resolve(event.data);
+          }
+        }
+      );
+      worker.addEventListener('error', (event) => {
+        // The worker failed to load or crashed: the next job starts a new one.
+        worker.terminate();
+        if (this.worker === worker) {
+          this.worker = undefined;
+        }
+        this.rejectAll(assertError(event.message));
+      });
+      this.worker = worker;
+    }
+    return this.worker;
+  }
+}
@@ -0,0 +1,127 @@
+/// <reference lib="webworker" />
+
+import { EmbindModule as DemanglerModule } from '../assets/web_demangler';
+import web_demangler from '../assets/web_demangler.js';
+import {
+  EmbindModule as FormatterModule,
+  FormatStyle,
+} from '../assets/web_formatter';
+import web_formatter from '../assets/web_formatter.js';
+import { EmbindModule as LightenModule } from '../assets/web_lighten';
+import web_lighten from '../assets/web_lighten.js';
+import { assertError } from './apps/shared/interfaces/errors';
+import {
+  WasmBatch,
+  WasmCancel,
+  WasmRequest,
+  WasmResponse,
+} from './wasm-worker-protocol';
+
+// Every module is instantiated on its first command.
+let demangler: Promise<DemanglerModule> | undefined;
+let formatter: Promise<FormatterModule> | undefined;
+let lighten: Promise<LightenModule> | undefined;
+
+// Jobs waiting for their module. Only they can be canceled: a cancel of a
+// started or finished job is ignored, so canceled can't grow.
+const waiting = new Set<number>();
+// Jobs canceled while their module was loading.
+const canceled = new Set<number>();
+
+// The style is only parsed again when its YAML changes.
+let lastStyle: { yaml: string; style: FormatStyle } | undefined;
+
+function getStyle(module: FormatterModule, yaml: string): FormatStyle {
+  if (lastStyle?.yaml !== yaml) {
+    const style = module.deserializeFromYaml(yaml);
+    lastStyle?.style.delete();
+    lastStyle = { yaml, style };
+  }
+  return lastStyle.style;
+}
+
+// Return false if the job was canceled, otherwise tell the service that its
+// native call begins.
+function start(id: number): boolean {
+  waiting.delete(id);
+  if (canceled.delete(id)) {
+    return false;
+  }
+  postMessage({ id, started: true } satisfies WasmResponse);
+  return true;
+}
+
+async function runFormatter(
+  request: WasmRequest
+): Promise<WasmBatch | undefined> {
+  formatter ??= web_formatter();
+  const module = await formatter;
+  const style = getStyle(module, request.style ?? '');
+  if (!start(request.id)) {
+    return undefined;
+  }
+  return (
+    request.command === 'format'
+      ? module.formatterBatch(request.text, request.offsets, style)
+      : module.demangleAndFormatBatch(request.text, request.offsets, style)
+  ) as WasmBatch;
+}
+
+async function run(request: WasmRequest): Promise<WasmBatch | undefined> {
+  switch (request.command) {
+    case 'demangle': {
+      demangler ??= web_demangler();
+      const module = await demangler;
+      if (!start(request.id)) {
+        return undefined;
+      }
+      return module.web_demangle_batch(
+        request.text,
+        request.offsets
+      ) as WasmBatch;
+    }
+    case 'format':
+    case 'demangleAndFormat':
+      return runFormatter(request);
+    case 'lightenJson': {
+      lighten ??= web_lighten();
+      const module = await lighten;
+      if (!start(request.id)) {
+        return undefined;
+      }
+      return module.web_lighten_json_batch(
+        request.text,
+        request.offsets,
+        request.size ?? 0
+      ) as WasmBatch;
+    }
+    default:
+      throw assertError(`Unknown command ${request.command}.`);
+  }
+}
+
+addEventListener('message', (event: MessageEvent<WasmCancel | WasmRequest>) => {
+  const { id } = event.data;
+  if ('cancel' in event.data) {
+    if (waiting.has(id)) {
+      canceled.add(id);
+    }
+    return;
+  }
+  waiting.add(id);
+  run(event.data).then(
+    (batch) => {
+      if (batch !== undefined) {
+        postMessage({ id, ...batch } satisfies WasmResponse, [
+          batch.text.buffer,
+          batch.offsets.buffer,
+        ]);
+      }
+    },
+    (err: unknown) => {
+      waiting.delete(id);
+      canceled.delete(id);
+      postMessage({ id, error: String(err) } satisfies WasmResponse);
+    }
+  );
+});
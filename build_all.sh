@@ -28,6 +28,7 @@ cd ../../..
 
 emcmake cmake -S cpp/webassembly -B build_webassembly_release -G "Ninja" -DCMAKE_BUILD_TYPE="Release"
 cmake --build build_webassembly_release --parallel $(nproc --all)
+cmake --build build_webassembly_release --target wasm_budget
 mkdir -p angular/src/assets
 rm -f angular/src/assets/*
 cp build_webassembly_release/web* angular/src/assets/
@@ -54,6 +55,33 @@ cd build_tests_release
 ctest
 cd ..
 
+# Benchmarks of the native code, then of the wasm modules.
+cmake -S cpp/tests/ -B build_tests_release_benchmark -DWITH_SANITIZE_ADDRESS=OFF -DWITH_SANITIZE_UNDEFINED=OFF -G "Ninja" -DCMAKE_BUILD_TYPE="Release"
+cmake --build build_tests_release_benchmark --target bench_demangler bench_lighten --parallel $(nproc --all)
+cd build_tests_release_benchmark
+./bench_demangler > bench_demangler.json
+if [ -f bench_lighten.json ]; then
+  mv bench_lighten.json bench_lighten.previous.json
+fi
+./bench_lighten lighten bench_lighten.previous.json > bench_lighten.json
+cd ..
+cpp/native/bench-cxxfilt.sh build_native_release/demangler_cli > build_native_release/bench_cxxfilt.txt
+
+# Profile-guided wasm: profile the benchmark corpora natively, then compare
+# the -O3 and -Oz wasm-opt profiles with the release build on the same corpora.
+cmake -S cpp/tests/ -B build_tests_release_pgo -DWITH_PGO_GENERATE=ON -G "Ninja" -DCMAKE_BUILD_TYPE="Release" -DCMAKE_C_COMPILER=/usr/bin/clang-${clang_version} -DCMAKE_CXX_COMPILER=/usr/bin/clang++-${clang_version} -DCMAKE_LINKER_TYPE=LLD
+cmake --build build_tests_release_pgo --target pgo_profile --parallel $(nproc --all)
+cd build_webassembly_release
+node ../cpp/webassembly/wasm-budget.mjs --iterations 50 --corpus ../cpp/tests/data --output wasm_budget_calls.json
+cd ..
+for level in O3 Oz; do
+  emcmake cmake -S cpp/webassembly -B build_webassembly_release_pgo_${level} -G "Ninja" -DCMAKE_BUILD_TYPE="Release" -DWASM_PGO_PROFILE=$(pwd)/build_tests_release_pgo/web.profdata -DWASM_OPT_LEVEL=-${level}
+  cmake --build build_webassembly_release_pgo_${level} --parallel $(nproc --all)
+  cd build_webassembly_release_pgo_${level}
+  node ../cpp/webassembly/wasm-budget.mjs --iterations 50 --corpus ../cpp/tests/data --baseline ../build_webassembly_release/wasm_budget_calls.json --output wasm_budget_calls.json
+  cd ..
+done
+
 # Build Angular project
 cd angular
 pnpm install
@@ -79,3 +107,5 @@ mkdir -p cpp/tests/output-lighten-number
 cmake -S cpp/tests/ -B build_tests_debug_fuzzer -DCMAKE_C_COMPILER=afl-clang-fast -DCMAKE_CXX_COMPILER=afl-clang-fast++ -DWITH_SANITIZE_ADDRESS=OFF -DWITH_SANITIZE_UNDEFINED=OFF -G "Ninja" -DCMAKE_BUILD_TYPE="Debug"
 cmake --build build_tests_debug_fuzzer --parallel $(nproc --all)
 afl-fuzz -i cpp/tests/seeds-lighten-number -o cpp/tests/output-lighten-number -- ./build_tests_debug_fuzzer/test_lighten_number
+mkdir -p cpp/tests/output-demangler
+afl-fuzz -i cpp/tests/seeds-demangler -o cpp/tests/output-demangler -- ./build_tests_debug_fuzzer/test_demangler
@@ -0,0 +1,105 @@
+#!/usr/bin/env bash
+# Compare demangler_cli with c++filt and llvm-cxxfilt on the same corpora.
+#
+# Usage: bench-cxxfilt.sh demangler_cli [corpus dir] [MiB] [runs]
+#
+# Each corpus of the corpus dir (cpp/tests/data/demangler) is repeated up to
+# MiB (64 by default) so that the startup of the tools doesn't count, then
+# every tool demangles it runs times (5 by default). The median time and
+# throughput are printed, with the speedup of each tool against c++filt ("-"
+# without c++filt).
+# demangler_cli is timed with one thread and with all of them. A tool whose
+# output differs from llvm-cxxfilt is marked: c++filt prints some names
+# differently and llvm-cxxfilt may leave the MSVC symbols as is.
+# c++filt and llvm-cxxfilt are looked up in the PATH, llvm-cxxfilt also with
+# the version suffixes of Debian. A missing tool is skipped.
+
+set -euo pipefail
+
+if [ $# -lt 1 ]; then
+  sed -n '4,4p' "$0" | sed 's/^# //' >&2
+  exit 1
+fi
+
+demangler_cli=$(realpath "$1")
+corpus_dir=${2:-$(dirname "$0")/../tests/data/demangler}
+mebibytes=${3:-64}
+runs=${4:-5}
+
+find_tool() {
+  local name
+  for name in "$@"; do
+    if command -v "$name" > /dev/null; then
+      command -v "$name"
+      return
+    fi
+  done
+}
+
+cxxfilt=$(find_tool c++filt)
+llvm_cxxfilt=$(find_tool llvm-cxxfilt $(compgen -c llvm-cxxfilt- | sort -rV))
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# Median of the run times of "$@" < input > output, in seconds.
+time_tool() {
+  local input=$1 output=$2
+  shift 2
+  local i start end
+  for ((i = 0; i < runs; i++)); do
+    start=$(date +%s%N)
+    "$@" < "$input" > "$output"
+    end=$(date +%s%N)
+    echo $((end - start))
+  done | sort -n |
+    awk '{ t[NR] = $1 } END { printf "%.6f", t[int((NR + 1) / 2)] / 1e9 }'
+}
+
+printf '%-8s %-16s %9s %9s %8s %s\n' corpus tool seconds MiB/s speedup output
+for corpus in "$corpus_dir"/*.txt; do
+  name=$(basename "$corpus" .txt)
+  input="$work/$name.txt"
+  : > "$input"
+  while [ "$(stat -c %s "$input")" -lt $((mebibytes * 1024 * 1024)) ]; do
+    cat "$corpus" >> "$input"
+  done
+  size=$(stat -c %s "$input")
+
+  tools=()
+  [ -n "$cxxfilt" ] && tools+=("c++filt")
+  [ -n "$llvm_cxxfilt" ] && tools+=("llvm-cxxfilt")
+  tools+=("demangler_cli-j1" "demangler_cli")
+
+  if [ -n "$llvm_cxxfilt" ]; then
+    "$llvm_cxxfilt" < "$input" > "$work/reference.txt"
+  fi
+
+  baseline=""
+  for tool in "${tools[@]}"; do
+    case $tool in
+    c++filt) command=("$cxxfilt") ;;
+    llvm-cxxfilt) command=("$llvm_cxxfilt") ;;
+    # The file is given to demangler_cli to keep its mmap.
+    demangler_cli-j1) command=("$demangler_cli" -j 1 "$input") ;;
+    demangler_cli) command=("$demangler_cli" "$input") ;;
+    esac
+    seconds=$(time_tool "$input" "$work/output.txt" "${command[@]}")
+    if [ "$tool" = "c++filt" ]; then
+      baseline=$seconds
+    fi
+    same="-"
+    if [ -n "$llvm_cxxfilt" ]; then
+      if cmp -s "$work/output.txt" "$work/reference.txt"; then
+        same="same"
+      else
+        same="differs"
+      fi
+    fi
+    awk -v name="$name" -v tool="$tool" -v seconds="$seconds" -v size="$size" \
+      -v baseline="$baseline" -v same="$same" 'BEGIN {
+        speedup = baseline == "" ? "-" : sprintf("%.2fx", baseline / seconds)
+        printf "%-8s %-16s %9.3f %9.1f %8s %s\n", name, tool, seconds,
+          size / 1048576 / seconds, speedup, same }'
+  done
+done
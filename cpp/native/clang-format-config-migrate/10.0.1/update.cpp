@@ -0,0 +1,195 @@
+#include "../update-helpers.h"
+#include "../9.0.1/Format.h"
+#include "../10.0.1/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v10 {
+
+constexpr frozen::unordered_map<bool, clang_v10::FormatStyle::ShortBlockStyle,
+                                2>
+    short_block_style{
+        {false, clang_v10::FormatStyle::ShortBlockStyle::SBS_Never},
+        {true, clang_v10::FormatStyle::ShortBlockStyle::SBS_Always}};
+
+constexpr frozen::unordered_map<
+    bool, clang_v10::FormatStyle::BraceWrappingAfterControlStatementStyle, 2>
+    brace_wrapping_after_control_statement_style{
+        {false, clang_v10::FormatStyle::
+                    BraceWrappingAfterControlStatementStyle::BWACS_Never},
+        {true, clang_v10::FormatStyle::BraceWrappingAfterControlStatementStyle::
+                   BWACS_Always}};
+
+template <clang_vx::Update Upgrade>
+void assign(std::vector<clang_v9::IncludeStyle::IncludeCategory> &old_field,
+            std::vector<clang_v10::IncludeStyle::IncludeCategory> &new_field) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field.clear();
+    new_field.reserve(old_field.size());
+    for (const auto &item : old_field) {
+      new_field.emplace_back(clang_v10::IncludeStyle::IncludeCategory{
+          item.Regex, item.Priority, {}});
+    }
+  } else {
+    old_field.clear();
+    old_field.reserve(new_field.size());
+    for (const auto &item : new_field) {
+      old_field.emplace_back(
+          clang_v9::IncludeStyle::IncludeCategory{item.Regex, item.Priority});
+      std::cout << "Warning when downgrading from version 10, field "
+                   "IncludeStyle.SortPriority ("
+                << item.SortPriority << ") have been dropped.\n";
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade>
+void update(clang_v9::FormatStyle &prev, clang_v10::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v10::getPredefinedStyle(
+            style, clang_v10::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v9::getPredefinedStyle(
+            style, clang_v9::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "9";
+  std::string_view next_version = "10";
+
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_SAME_FIELD(AlignOperands);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AllowAllArgumentsOnNextLine);
+  ASSIGN_SAME_FIELD(AllowAllConstructorInitializersOnNextLine);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  SWITCH_TO_ENUM(AllowShortBlocksOnASingleLine, short_block_style);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortLambdasOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterCaseLabel);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  SWITCH_TO_ENUM(BraceWrapping.AfterControlStatement,
+                 brace_wrapping_after_control_statement_style);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_MAGIC_ENUM(BreakInheritanceList);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  NEW_FIELD(DeriveLineEnding);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_SAME_FIELD(TypenameMacros);
+  ASSIGN_SAME_FIELD(StatementMacros);
+  ASSIGN_SAME_FIELD(NamespaceMacros);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.IncludeBlocks);
+  assign<Upgrade>(prev.IncludeStyle.IncludeCategories,
+                  next.IncludeStyle.IncludeCategories);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainRegex);
+  NEW_FIELD(IncludeStyle.IncludeIsMainSourceRegex);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  NEW_FIELD(IndentGotoLabels);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_SAME_FIELD(JavaImportGroups);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_MAGIC_ENUM(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_RAW_STRING_FORMAT(RawStringFormats, 9, 10);
+  ASSIGN_SAME_FIELD(ReflowComments);
+  ASSIGN_SAME_FIELD(SortIncludes);
+  ASSIGN_SAME_FIELD(SortUsingDeclarations);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterLogicalNot);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(SpaceBeforeCpp11BracedList);
+  ASSIGN_SAME_FIELD(SpaceBeforeCtorInitializerColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  NEW_FIELD(SpaceInEmptyBlock);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_SAME_FIELD(SpacesInAngles);
+  NEW_FIELD(SpacesInConditionalStatement);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  NEW_FIELD(SpaceBeforeSquareBrackets);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(TabWidth);
+  NEW_FIELD(UseCRLF);
+  ASSIGN_MAGIC_ENUM(UseTab);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v9::FormatStyle &prev,
+                                                clang_v10::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v9::FormatStyle &prev,
+                                                  clang_v10::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v10
@@ -0,0 +1,250 @@
+#include "../update-helpers.h"
+#include "../13.0.1/Format.h"
+#include "../14.0.6/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v14 {
+
+template <clang_vx::Update Upgrade>
+void update(clang_v13::FormatStyle &prev, clang_v14::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v14::getPredefinedStyle(
+            style, clang_v14::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v13::getPredefinedStyle(
+            style, clang_v13::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "13";
+  std::string_view next_version = "14";
+
+  ASSIGN_SAME_FIELD(InheritsParentConfig);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_MAGIC_ENUM(AlignArrayOfStructures);
+  ASSIGN_MAGIC_ENUM(AlignConsecutiveMacros);
+  ASSIGN_MAGIC_ENUM(AlignConsecutiveAssignments);
+  ASSIGN_MAGIC_ENUM(AlignConsecutiveBitFields);
+  ASSIGN_MAGIC_ENUM(AlignConsecutiveDeclarations);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_MAGIC_ENUM(AlignOperands);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AllowAllArgumentsOnNextLine);
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    ASSIGN_SAME_FIELD(AllowAllConstructorInitializersOnNextLine);
+  }
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(AllowShortEnumsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortLambdasOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(AttributeMacros);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_MAGIC_ENUM(InsertTrailingCommas);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterCaseLabel);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  ASSIGN_MAGIC_ENUM(BraceWrapping.AfterControlStatement);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeLambdaBody);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeWhile);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  ASSIGN_SAME_FIELD(BreakBeforeConceptDeclarations);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  NEW_FIELD(QualifierAlignment);
+  NEW_FIELD(QualifierOrder);
+  ASSIGN_MAGIC_ENUM(BreakInheritanceList);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  }
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(DeriveLineEnding);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_MAGIC_ENUM(EmptyLineAfterAccessModifier);
+  ASSIGN_MAGIC_ENUM(EmptyLineBeforeAccessModifier);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  NEW_FIELD(PackConstructorInitializers);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_SAME_FIELD(IfMacros);
+  ASSIGN_SAME_FIELD(TypenameMacros);
+  ASSIGN_SAME_FIELD(StatementMacros);
+  ASSIGN_SAME_FIELD(NamespaceMacros);
+  ASSIGN_SAME_FIELD(WhitespaceSensitiveMacros);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.IncludeBlocks);
+  ASSIGN_INCLUDE_CATEGORY3(IncludeStyle.IncludeCategories);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainRegex);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainSourceRegex);
+  ASSIGN_SAME_FIELD(IndentAccessModifiers);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_SAME_FIELD(IndentCaseBlocks);
+  ASSIGN_SAME_FIELD(IndentGotoLabels);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_MAGIC_ENUM(IndentExternBlock);
+  ASSIGN_SAME_FIELD(IndentRequires);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_SAME_FIELD(JavaImportGroups);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_MAGIC_ENUM(LambdaBodyIndentation);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_MAGIC_ENUM(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCBreakBeforeNestedBlockParam);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  NEW_FIELD(PenaltyBreakOpenParenthesis);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_SAME_FIELD(PenaltyIndentedWhitespace);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_SAME_FIELD(PPIndentWidth);
+  ASSIGN_RAW_STRING_FORMAT(RawStringFormats, 13, 14);
+  ASSIGN_MAGIC_ENUM(ReferenceAlignment);
+  ASSIGN_SAME_FIELD(ReflowComments);
+  NEW_FIELD(RemoveBracesLLVM);
+  NEW_FIELD(SeparateDefinitionBlocks);
+  ASSIGN_SAME_FIELD(ShortNamespaceLines);
+  ASSIGN_MAGIC_ENUM(SortIncludes);
+  ASSIGN_MAGIC_ENUM(SortJavaStaticImport);
+  ASSIGN_SAME_FIELD(SortUsingDeclarations);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterLogicalNot);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_MAGIC_ENUM(SpaceAroundPointerQualifiers);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(SpaceBeforeCaseColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeCpp11BracedList);
+  ASSIGN_SAME_FIELD(SpaceBeforeCtorInitializerColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterControlStatements);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterForeachMacros);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterFunctionDeclarationName);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterFunctionDefinitionName);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterIfMacros);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterOverloadedOperator);
+  NEW_FIELD(SpaceBeforeParensOptions.BeforeNonEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  ASSIGN_SAME_FIELD(SpaceInEmptyBlock);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_MAGIC_ENUM(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInConditionalStatement);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Minimum);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Maximum);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_SAME_FIELD(SpaceBeforeSquareBrackets);
+  ASSIGN_MAGIC_ENUM(BitFieldColonSpacing);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(StatementAttributeLikeMacros);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_SAME_FIELD(UseCRLF);
+  ASSIGN_MAGIC_ENUM(UseTab);
+
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    bool IsGoogleOrChromium = style == "google" || style == "chromium";
+    bool OnCurrentLine = next.ConstructorInitializerAllOnOneLineOrOnePerLine;
+    bool OnNextLine = next.AllowAllConstructorInitializersOnNextLine;
+    if (!IsGoogleOrChromium) {
+      if (next.PackConstructorInitializers ==
+              clang_v14::FormatStyle::PackConstructorInitializersStyle::
+                  PCIS_BinPack &&
+          OnCurrentLine) {
+        next.PackConstructorInitializers =
+            OnNextLine ? clang_v14::FormatStyle::
+                             PackConstructorInitializersStyle::PCIS_NextLine
+                       : clang_v14::FormatStyle::
+                             PackConstructorInitializersStyle::PCIS_CurrentLine;
+      }
+    } else if (next.PackConstructorInitializers ==
+               clang_v14::FormatStyle::PackConstructorInitializersStyle::
+                   PCIS_NextLine) {
+      if (!OnCurrentLine)
+        next.PackConstructorInitializers = clang_v14::FormatStyle::
+            PackConstructorInitializersStyle::PCIS_BinPack;
+      else if (!OnNextLine)
+        next.PackConstructorInitializers = clang_v14::FormatStyle::
+            PackConstructorInitializersStyle::PCIS_CurrentLine;
+    }
+  } else {
+    prev.ConstructorInitializerAllOnOneLineOrOnePerLine =
+        next.PackConstructorInitializers ==
+            clang_v14::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_CurrentLine ||
+        next.PackConstructorInitializers ==
+            clang_v14::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_BinPack;
+
+    prev.AllowAllConstructorInitializersOnNextLine =
+        next.PackConstructorInitializers ==
+            clang_v14::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_NextLine ||
+        next.PackConstructorInitializers ==
+            clang_v14::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_BinPack;
+
+    std::cout << "Warning when downgrading from version 14. Field "
+                 "ConstructorInitializerAllOnOneLineOrOnePerLine and "
+                 "AllowAllConstructorInitializersOnNextLine is unsured.\n";
+  }
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v13::FormatStyle &prev,
+                                                clang_v14::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v13::FormatStyle &prev,
+                                                  clang_v14::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v14
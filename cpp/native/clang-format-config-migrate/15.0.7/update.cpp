@@ -0,0 +1,262 @@
+#include "../update-helpers.h"
+#include "../14.0.6/Format.h"
+#include "../15.0.7/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_v15 {
+
+std::ostream &
+operator<<(std::ostream &os,
+           const clang_v15::FormatStyle::AlignConsecutiveStyle &data) {
+  os << "{" << "Enabled: " << data.Enabled
+     << ", AcrossEmptyLines: " << data.AcrossEmptyLines
+     << ", AcrossComments: " << data.AcrossComments
+     << ", AlignCompound: " << data.AlignCompound
+     << ", PadOperators: " << data.PadOperators << "}";
+  return os;
+}
+
+} // namespace clang_v15
+
+namespace clang_update_v15 {
+
+constexpr frozen::unordered_map<clang_v14::FormatStyle::AlignConsecutiveStyle,
+                                clang_v15::FormatStyle::AlignConsecutiveStyle,
+                                5>
+    align_consecutive_style{
+        {clang_v14::FormatStyle::AlignConsecutiveStyle::ACS_None,
+         {false, false, false, false, true}},
+        {clang_v14::FormatStyle::AlignConsecutiveStyle::ACS_Consecutive,
+         {true, false, false, false, true}},
+        {clang_v14::FormatStyle::AlignConsecutiveStyle::ACS_AcrossEmptyLines,
+         {true, true, false, false, true}},
+        {clang_v14::FormatStyle::AlignConsecutiveStyle::ACS_AcrossComments,
+         {true, false, true, false, true}},
+        {clang_v14::FormatStyle::AlignConsecutiveStyle::
+             ACS_AcrossEmptyLinesAndComments,
+         {true, true, true, false, true}}};
+
+constexpr frozen::unordered_map<
+    bool, clang_v15::FormatStyle::BreakBeforeConceptDeclarationsStyle, 2>
+    break_before_concept_declarations_style{
+        {false, clang_v15::FormatStyle::BreakBeforeConceptDeclarationsStyle::
+                    BBCDS_Allowed},
+        {true, clang_v15::FormatStyle::BreakBeforeConceptDeclarationsStyle::
+                   BBCDS_Always}};
+
+template <clang_vx::Update Upgrade>
+void update(clang_v14::FormatStyle &prev, clang_v15::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v15::getPredefinedStyle(
+            style, clang_v15::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v14::getPredefinedStyle(
+            style, clang_v14::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "14";
+  std::string_view next_version = "15";
+
+  ASSIGN_SAME_FIELD(InheritsParentConfig);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_MAGIC_ENUM(AlignArrayOfStructures);
+  SWITCH_TO_ENUM(AlignConsecutiveMacros, align_consecutive_style);
+  SWITCH_TO_ENUM(AlignConsecutiveAssignments, align_consecutive_style);
+  SWITCH_TO_ENUM(AlignConsecutiveBitFields, align_consecutive_style);
+  SWITCH_TO_ENUM(AlignConsecutiveDeclarations, align_consecutive_style);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_MAGIC_ENUM(AlignOperands);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AllowAllArgumentsOnNextLine);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(AllowShortEnumsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortLambdasOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(AttributeMacros);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_MAGIC_ENUM(InsertTrailingCommas);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterCaseLabel);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  ASSIGN_MAGIC_ENUM(BraceWrapping.AfterControlStatement);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeLambdaBody);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeWhile);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  SWITCH_TO_ENUM(BreakBeforeConceptDeclarations,
+                 break_before_concept_declarations_style);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_MAGIC_ENUM(QualifierAlignment);
+  ASSIGN_SAME_FIELD(QualifierOrder);
+  ASSIGN_MAGIC_ENUM(BreakInheritanceList);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(DeriveLineEnding);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_MAGIC_ENUM(EmptyLineAfterAccessModifier);
+  ASSIGN_MAGIC_ENUM(EmptyLineBeforeAccessModifier);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_SAME_FIELD(IfMacros);
+  ASSIGN_SAME_FIELD(TypenameMacros);
+  ASSIGN_SAME_FIELD(StatementMacros);
+  ASSIGN_SAME_FIELD(NamespaceMacros);
+  ASSIGN_SAME_FIELD(WhitespaceSensitiveMacros);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.IncludeBlocks);
+  ASSIGN_INCLUDE_CATEGORY3(IncludeStyle.IncludeCategories);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainRegex);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainSourceRegex);
+  ASSIGN_SAME_FIELD(IndentAccessModifiers);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_SAME_FIELD(IndentCaseBlocks);
+  ASSIGN_SAME_FIELD(IndentGotoLabels);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_MAGIC_ENUM(IndentExternBlock);
+  RENAME_FIELD(IndentRequires, IndentRequiresClause);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  NEW_FIELD(InsertBraces);
+  ASSIGN_SAME_FIELD(JavaImportGroups);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_MAGIC_ENUM(LambdaBodyIndentation);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_MAGIC_ENUM(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCBreakBeforeNestedBlockParam);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakOpenParenthesis);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_SAME_FIELD(PenaltyIndentedWhitespace);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_SAME_FIELD(PPIndentWidth);
+  ASSIGN_RAW_STRING_FORMAT(RawStringFormats, 14, 15);
+  ASSIGN_MAGIC_ENUM(ReferenceAlignment);
+  ASSIGN_SAME_FIELD(ReflowComments);
+  ASSIGN_SAME_FIELD(RemoveBracesLLVM);
+  NEW_FIELD(RequiresClausePosition);
+  ASSIGN_MAGIC_ENUM(SeparateDefinitionBlocks);
+  ASSIGN_SAME_FIELD(ShortNamespaceLines);
+  ASSIGN_MAGIC_ENUM(SortIncludes);
+  ASSIGN_MAGIC_ENUM(SortJavaStaticImport);
+  ASSIGN_SAME_FIELD(SortUsingDeclarations);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterLogicalNot);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_MAGIC_ENUM(SpaceAroundPointerQualifiers);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(SpaceBeforeCaseColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeCpp11BracedList);
+  ASSIGN_SAME_FIELD(SpaceBeforeCtorInitializerColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterControlStatements);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterForeachMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDeclarationName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDefinitionName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterIfMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterOverloadedOperator);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterRequiresInClause);
+  NEW_FIELD(SpaceBeforeParensOptions.AfterRequiresInExpression);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.BeforeNonEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  ASSIGN_SAME_FIELD(SpaceInEmptyBlock);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_MAGIC_ENUM(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInConditionalStatement);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Minimum);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Maximum);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_SAME_FIELD(SpaceBeforeSquareBrackets);
+  ASSIGN_MAGIC_ENUM(BitFieldColonSpacing);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(StatementAttributeLikeMacros);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_SAME_FIELD(UseCRLF);
+  ASSIGN_MAGIC_ENUM(UseTab);
+
+  if constexpr (Upgrade == clang_vx::Update::DOWNGRADE) {
+    prev.ConstructorInitializerAllOnOneLineOrOnePerLine =
+        next.PackConstructorInitializers ==
+            clang_v15::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_CurrentLine ||
+        next.PackConstructorInitializers ==
+            clang_v15::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_BinPack;
+
+    prev.AllowAllConstructorInitializersOnNextLine =
+        next.PackConstructorInitializers ==
+            clang_v15::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_NextLine ||
+        next.PackConstructorInitializers ==
+            clang_v15::FormatStyle::PackConstructorInitializersStyle::
+                PCIS_BinPack;
+
+    std::cout << "Warning when downgrading from version 15. Field "
+                 "ConstructorInitializerAllOnOneLineOrOnePerLine and "
+                 "AllowAllConstructorInitializersOnNextLine is unsure.\n";
+  }
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v14::FormatStyle &prev,
+                                                clang_v15::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v14::FormatStyle &prev,
+                                                  clang_v15::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v15
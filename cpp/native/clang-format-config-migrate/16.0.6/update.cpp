@@ -0,0 +1,275 @@
+#include "../update-helpers.h"
+#include "../15.0.7/Format.h"
+#include "../16.0.6/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_v16 {
+
+std::ostream &
+operator<<(std::ostream &os,
+           const clang_v16::FormatStyle::TrailingCommentsAlignmentStyle &data) {
+  os << "{" << "Kind: " << data.Kind
+     << ", OverEmptyLines: " << data.OverEmptyLines << "}";
+  return os;
+}
+
+} // namespace clang_v16
+
+namespace clang_update_v16 {
+
+constexpr frozen::unordered_map<
+    bool, clang_v16::FormatStyle::TrailingCommentsAlignmentStyle, 2>
+    trailing_comments_alignment_style{
+        {false,
+         {clang_v16::FormatStyle::TrailingCommentsAlignmentKinds::TCAS_Never,
+          0}},
+        {true,
+         {clang_v16::FormatStyle::TrailingCommentsAlignmentKinds::TCAS_Always,
+          0}}};
+
+constexpr frozen::unordered_map<
+    bool, clang_v16::FormatStyle::SortUsingDeclarationsOptions, 2>
+    sort_using_declarations_options{
+        {false,
+         clang_v16::FormatStyle::SortUsingDeclarationsOptions::SUD_Never},
+        {true, clang_v16::FormatStyle::SortUsingDeclarationsOptions::
+                   SUD_LexicographicNumeric}};
+
+template <clang_vx::Update Upgrade>
+void update(clang_v15::FormatStyle &prev, clang_v16::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v16::getPredefinedStyle(
+            style, clang_v16::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v15::getPredefinedStyle(
+            style, clang_v15::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "15";
+  std::string_view next_version = "16";
+
+  ASSIGN_SAME_FIELD(InheritsParentConfig);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_MAGIC_ENUM(AlignArrayOfStructures);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.PadOperators);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_MAGIC_ENUM(AlignOperands);
+  SWITCH_TO_ENUM(AlignTrailingComments, trailing_comments_alignment_style);
+  ASSIGN_SAME_FIELD(AllowAllArgumentsOnNextLine);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(AllowShortEnumsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortLambdasOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(AttributeMacros);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_MAGIC_ENUM(InsertTrailingCommas);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterCaseLabel);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  ASSIGN_MAGIC_ENUM(BraceWrapping.AfterControlStatement);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeLambdaBody);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeWhile);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  ASSIGN_MAGIC_ENUM(BreakBeforeConceptDeclarations);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  NEW_FIELD(BreakBeforeInlineASMColon);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_MAGIC_ENUM(QualifierAlignment);
+  ASSIGN_SAME_FIELD(QualifierOrder);
+  ASSIGN_MAGIC_ENUM(BreakInheritanceList);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    next.LineEnding =
+        prev.DeriveLineEnding
+            ? (prev.UseCRLF
+                   ? clang_v16::FormatStyle::LineEndingStyle::LE_DeriveCRLF
+                   : clang_v16::FormatStyle::LineEndingStyle::LE_DeriveLF)
+            : (prev.UseCRLF ? clang_v16::FormatStyle::LineEndingStyle::LE_CRLF
+                            : clang_v16::FormatStyle::LineEndingStyle::LE_LF);
+  } else {
+    prev.UseCRLF =
+        next.LineEnding ==
+            clang_v16::FormatStyle::LineEndingStyle::LE_DeriveCRLF ||
+        next.LineEnding == clang_v16::FormatStyle::LineEndingStyle::LE_CRLF;
+    prev.DeriveLineEnding =
+        next.LineEnding ==
+            clang_v16::FormatStyle::LineEndingStyle::LE_DeriveCRLF ||
+        next.LineEnding == clang_v16::FormatStyle::LineEndingStyle::LE_DeriveLF;
+  }
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_MAGIC_ENUM(EmptyLineAfterAccessModifier);
+  ASSIGN_MAGIC_ENUM(EmptyLineBeforeAccessModifier);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_MAGIC_ENUM(PackConstructorInitializers);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.IncludeBlocks);
+  ASSIGN_INCLUDE_CATEGORY3(IncludeStyle.IncludeCategories);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainRegex);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainSourceRegex);
+  ASSIGN_SAME_FIELD(IfMacros);
+  ASSIGN_SAME_FIELD(TypenameMacros);
+  ASSIGN_SAME_FIELD(StatementMacros);
+  ASSIGN_SAME_FIELD(NamespaceMacros);
+  ASSIGN_SAME_FIELD(WhitespaceSensitiveMacros);
+  ASSIGN_SAME_FIELD(IndentAccessModifiers);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_SAME_FIELD(IndentCaseBlocks);
+  ASSIGN_SAME_FIELD(IndentGotoLabels);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_MAGIC_ENUM(IndentExternBlock);
+  ASSIGN_SAME_FIELD(IndentRequiresClause);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_SAME_FIELD(InsertBraces);
+  ASSIGN_SAME_FIELD(JavaImportGroups);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_MAGIC_ENUM(LambdaBodyIndentation);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_MAGIC_ENUM(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCBreakBeforeNestedBlockParam);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakOpenParenthesis);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_SAME_FIELD(PenaltyIndentedWhitespace);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_SAME_FIELD(PPIndentWidth);
+  ASSIGN_RAW_STRING_FORMAT(RawStringFormats, 15, 16);
+  ASSIGN_MAGIC_ENUM(ReferenceAlignment);
+  ASSIGN_SAME_FIELD(ReflowComments);
+  ASSIGN_SAME_FIELD(RemoveBracesLLVM);
+  NEW_FIELD(RemoveSemicolon);
+  NEW_FIELD(BreakAfterAttributes);
+  NEW_FIELD(BreakArrays);
+  NEW_FIELD(InsertNewlineAtEOF);
+  NEW_FIELD(IntegerLiteralSeparator.Binary);
+  NEW_FIELD(IntegerLiteralSeparator.BinaryMinDigits);
+  NEW_FIELD(IntegerLiteralSeparator.Decimal);
+  NEW_FIELD(IntegerLiteralSeparator.DecimalMinDigits);
+  NEW_FIELD(IntegerLiteralSeparator.Hex);
+  NEW_FIELD(IntegerLiteralSeparator.HexMinDigits);
+  ASSIGN_MAGIC_ENUM(RequiresClausePosition);
+  NEW_FIELD(RequiresExpressionIndentation);
+  ASSIGN_MAGIC_ENUM(SeparateDefinitionBlocks);
+  ASSIGN_SAME_FIELD(ShortNamespaceLines);
+  ASSIGN_MAGIC_ENUM(SortIncludes);
+  ASSIGN_MAGIC_ENUM(SortJavaStaticImport);
+  SWITCH_TO_ENUM(SortUsingDeclarations, sort_using_declarations_options);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterLogicalNot);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_MAGIC_ENUM(SpaceAroundPointerQualifiers);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(SpaceBeforeCaseColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeCpp11BracedList);
+  ASSIGN_SAME_FIELD(SpaceBeforeCtorInitializerColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterControlStatements);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterForeachMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDeclarationName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDefinitionName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterIfMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterOverloadedOperator);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterRequiresInClause);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterRequiresInExpression);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.BeforeNonEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  ASSIGN_SAME_FIELD(SpaceInEmptyBlock);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_MAGIC_ENUM(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInConditionalStatement);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Minimum);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Maximum);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_SAME_FIELD(SpaceBeforeSquareBrackets);
+  ASSIGN_MAGIC_ENUM(BitFieldColonSpacing);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(StatementAttributeLikeMacros);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_MAGIC_ENUM(UseTab);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v15::FormatStyle &prev,
+                                                clang_v16::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v15::FormatStyle &prev,
+                                                  clang_v16::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v16
@@ -0,0 +1,278 @@
+#include "../update-helpers.h"
+#include "../18.1.8/Format.h"
+#include "../19.1.6/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v19 {
+
+template <clang_vx::Update Upgrade>
+void update(clang_v18::FormatStyle &prev, clang_v19::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v19::getPredefinedStyle(
+            style, clang_v19::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v18::getPredefinedStyle(
+            style, clang_v18::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "18";
+  std::string_view next_version = "19";
+
+  ASSIGN_SAME_FIELD(InheritsParentConfig);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_MAGIC_ENUM(AlignArrayOfStructures);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AlignCompound);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AcrossComments);
+  NEW_FIELD(AlignConsecutiveShortCaseStatements.AlignCaseArrows);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AlignCaseColons);
+  NEW_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.Enabled);
+  NEW_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.AcrossEmptyLines);
+  NEW_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.AcrossComments);
+  NEW_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.AlignCompound);
+  NEW_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.AlignFunctionPointers);
+  NEW_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.PadOperators);
+  NEW_FIELD(AlignConsecutiveTableGenCondOperatorColons.Enabled);
+  NEW_FIELD(AlignConsecutiveTableGenCondOperatorColons.AcrossEmptyLines);
+  NEW_FIELD(AlignConsecutiveTableGenCondOperatorColons.AcrossComments);
+  NEW_FIELD(AlignConsecutiveTableGenCondOperatorColons.AlignCompound);
+  NEW_FIELD(AlignConsecutiveTableGenCondOperatorColons.AlignFunctionPointers);
+  NEW_FIELD(AlignConsecutiveTableGenCondOperatorColons.PadOperators);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.Enabled);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.AcrossEmptyLines);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.AcrossComments);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.AlignCompound);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.AlignFunctionPointers);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.PadOperators);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_MAGIC_ENUM(AlignOperands);
+  ASSIGN_MAGIC_ENUM(AlignTrailingComments.Kind);
+  ASSIGN_SAME_FIELD(AlignTrailingComments.OverEmptyLines);
+  ASSIGN_SAME_FIELD(AllowAllArgumentsOnNextLine);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_MAGIC_ENUM(AllowBreakBeforeNoexceptSpecifier);
+  ASSIGN_MAGIC_ENUM(AllowShortBlocksOnASingleLine);
+  NEW_FIELD(AllowShortCaseExpressionOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCompoundRequirementOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortEnumsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortLambdasOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_SAME_FIELD(AttributeMacros);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BitFieldColonSpacing);
+  ASSIGN_SAME_FIELD(BracedInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterCaseLabel);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  ASSIGN_MAGIC_ENUM(BraceWrapping.AfterControlStatement);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeLambdaBody);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeWhile);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  ASSIGN_SAME_FIELD(BreakAdjacentStringLiterals);
+  ASSIGN_MAGIC_ENUM(BreakAfterAttributes);
+  RENAME_MAGIC_ENUM(AlwaysBreakAfterReturnType, BreakAfterReturnType);
+  ASSIGN_SAME_FIELD(BreakArrays);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_MAGIC_ENUM(BreakBeforeConceptDeclarations);
+  ASSIGN_MAGIC_ENUM(BreakBeforeInlineASMColon);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  NEW_FIELD(BreakFunctionDefinitionParameters);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_MAGIC_ENUM(BreakInheritanceList);
+  RENAME_MAGIC_ENUM(AlwaysBreakTemplateDeclarations, BreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_MAGIC_ENUM(EmptyLineAfterAccessModifier);
+  ASSIGN_MAGIC_ENUM(EmptyLineBeforeAccessModifier);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.IncludeBlocks);
+  ASSIGN_INCLUDE_CATEGORY3(IncludeStyle.IncludeCategories);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainRegex);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainSourceRegex);
+  NEW_FIELD(IncludeStyle.MainIncludeChar);
+  ASSIGN_SAME_FIELD(IfMacros);
+  ASSIGN_SAME_FIELD(IndentAccessModifiers);
+  ASSIGN_SAME_FIELD(IndentCaseBlocks);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_SAME_FIELD(IndentGotoLabels);
+  ASSIGN_MAGIC_ENUM(IndentExternBlock);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_SAME_FIELD(IndentRequiresClause);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_SAME_FIELD(InsertBraces);
+  ASSIGN_SAME_FIELD(InsertNewlineAtEOF);
+  ASSIGN_MAGIC_ENUM(InsertTrailingCommas);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.Binary);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.BinaryMinDigits);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.Decimal);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.DecimalMinDigits);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.Hex);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.HexMinDigits);
+  ASSIGN_SAME_FIELD(JavaImportGroups);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  RENAME_FIELD(KeepEmptyLinesAtEOF, KeepEmptyLines.AtEndOfFile);
+  RENAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks, KeepEmptyLines.AtStartOfBlock);
+  NEW_FIELD(KeepEmptyLines.AtStartOfFile);
+  ASSIGN_MAGIC_ENUM(LambdaBodyIndentation);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_MAGIC_ENUM(LineEnding);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(Macros);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_SAME_FIELD(NamespaceMacros);
+  ASSIGN_MAGIC_ENUM(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCBreakBeforeNestedBlockParam);
+  ASSIGN_SAME_FIELD(ObjCPropertyAttributeOrder);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_MAGIC_ENUM(PackConstructorInitializers);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakOpenParenthesis);
+  ASSIGN_SAME_FIELD(PenaltyBreakScopeResolution);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyIndentedWhitespace);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_SAME_FIELD(PPIndentWidth);
+  ASSIGN_MAGIC_ENUM(QualifierAlignment);
+  ASSIGN_SAME_FIELD(QualifierOrder);
+  ASSIGN_RAW_STRING_FORMAT(RawStringFormats, 18, 19);
+  ASSIGN_MAGIC_ENUM(ReferenceAlignment);
+  ASSIGN_SAME_FIELD(ReflowComments);
+  ASSIGN_SAME_FIELD(RemoveBracesLLVM);
+  ASSIGN_MAGIC_ENUM(RemoveParentheses);
+  ASSIGN_SAME_FIELD(RemoveSemicolon);
+  ASSIGN_MAGIC_ENUM(RequiresClausePosition);
+  ASSIGN_MAGIC_ENUM(RequiresExpressionIndentation);
+  ASSIGN_MAGIC_ENUM(SeparateDefinitionBlocks);
+  ASSIGN_SAME_FIELD(ShortNamespaceLines);
+  ASSIGN_SAME_FIELD(SkipMacroDefinitionBody);
+  ASSIGN_MAGIC_ENUM(SortIncludes);
+  ASSIGN_MAGIC_ENUM(SortJavaStaticImport);
+  ASSIGN_MAGIC_ENUM(SortUsingDeclarations);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterLogicalNot);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_MAGIC_ENUM(SpaceAroundPointerQualifiers);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(SpaceBeforeCaseColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeCpp11BracedList);
+  ASSIGN_SAME_FIELD(SpaceBeforeCtorInitializerColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeJsonColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterControlStatements);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterForeachMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDeclarationName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDefinitionName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterIfMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterOverloadedOperator);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterPlacementOperator);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterRequiresInClause);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterRequiresInExpression);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.BeforeNonEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpaceBeforeSquareBrackets);
+  ASSIGN_SAME_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  ASSIGN_SAME_FIELD(SpaceInEmptyBlock);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_MAGIC_ENUM(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Minimum);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Maximum);
+  ASSIGN_MAGIC_ENUM(SpacesInParens);
+  NEW_FIELD(SpacesInParensOptions.ExceptDoubleParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.InConditionalStatements);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.InCStyleCasts);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.InEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.Other);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(StatementAttributeLikeMacros);
+  ASSIGN_SAME_FIELD(StatementMacros);
+  NEW_FIELD(TableGenBreakingDAGArgOperators);
+  NEW_FIELD(TableGenBreakInsideDAGArg);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_SAME_FIELD(TypeNames);
+  ASSIGN_SAME_FIELD(TypenameMacros);
+  ASSIGN_MAGIC_ENUM(UseTab);
+  ASSIGN_SAME_FIELD(VerilogBreakBetweenInstancePorts);
+  ASSIGN_SAME_FIELD(WhitespaceSensitiveMacros);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v18::FormatStyle &prev,
+                                                clang_v19::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v18::FormatStyle &prev,
+                                                  clang_v19::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v19
@@ -0,0 +1,315 @@
+#include "../update-helpers.h"
+#include "../19.1.6/Format.h"
+#include "../20.1.6/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v20 {
+
+constexpr frozen::unordered_map<
+    bool, clang_v20::FormatStyle::BinPackParametersStyle, 2>
+    bin_pack_parameters_style{
+        {false,
+         clang_v20::FormatStyle::BinPackParametersStyle::BPPS_OnePerLine},
+        {true, clang_v20::FormatStyle::BinPackParametersStyle::BPPS_BinPack}};
+
+constexpr frozen::unordered_map<bool,
+                                clang_v20::FormatStyle::ReflowCommentsStyle, 2>
+    reflow_comments_style{
+        {false, clang_v20::FormatStyle::ReflowCommentsStyle::RCS_Never},
+        {true, clang_v20::FormatStyle::ReflowCommentsStyle::RCS_Always}};
+
+template <clang_vx::Update Upgrade>
+void update(clang_v19::FormatStyle &prev, clang_v20::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v20::getPredefinedStyle(
+            style, clang_v20::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v19::getPredefinedStyle(
+            style, clang_v19::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "19";
+  std::string_view next_version = "20";
+
+  ASSIGN_SAME_FIELD(InheritsParentConfig);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_MAGIC_ENUM(AlignArrayOfStructures);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AlignCompound);
+  NEW_FIELD(AlignConsecutiveMacros.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveMacros.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AlignCompound);
+  NEW_FIELD(AlignConsecutiveAssignments.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AlignCompound);
+  NEW_FIELD(AlignConsecutiveBitFields.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveBitFields.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AlignCompound);
+  NEW_FIELD(AlignConsecutiveDeclarations.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AlignCaseArrows);
+  ASSIGN_SAME_FIELD(AlignConsecutiveShortCaseStatements.AlignCaseColons);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.Enabled);
+  ASSIGN_SAME_FIELD(
+      AlignConsecutiveTableGenBreakingDAGArgColons.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(
+      AlignConsecutiveTableGenBreakingDAGArgColons.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.AlignCompound);
+  NEW_FIELD(
+      AlignConsecutiveTableGenBreakingDAGArgColons.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(
+      AlignConsecutiveTableGenBreakingDAGArgColons.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenBreakingDAGArgColons.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenCondOperatorColons.Enabled);
+  ASSIGN_SAME_FIELD(
+      AlignConsecutiveTableGenCondOperatorColons.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenCondOperatorColons.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenCondOperatorColons.AlignCompound);
+  NEW_FIELD(
+      AlignConsecutiveTableGenCondOperatorColons.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(
+      AlignConsecutiveTableGenCondOperatorColons.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenCondOperatorColons.PadOperators);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenDefinitionColons.Enabled);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenDefinitionColons.AcrossEmptyLines);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenDefinitionColons.AcrossComments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenDefinitionColons.AlignCompound);
+  NEW_FIELD(AlignConsecutiveTableGenDefinitionColons.AlignFunctionDeclarations);
+  ASSIGN_SAME_FIELD(
+      AlignConsecutiveTableGenDefinitionColons.AlignFunctionPointers);
+  ASSIGN_SAME_FIELD(AlignConsecutiveTableGenDefinitionColons.PadOperators);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_MAGIC_ENUM(AlignOperands);
+  ASSIGN_MAGIC_ENUM(AlignTrailingComments.Kind);
+  ASSIGN_SAME_FIELD(AlignTrailingComments.OverEmptyLines);
+  ASSIGN_SAME_FIELD(AllowAllArgumentsOnNextLine);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_MAGIC_ENUM(AllowBreakBeforeNoexceptSpecifier);
+  ASSIGN_MAGIC_ENUM(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseExpressionOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCompoundRequirementOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortEnumsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortLambdasOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  NEW_FIELD(AllowShortNamespacesOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_SAME_FIELD(AttributeMacros);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  SWITCH_TO_ENUM(BinPackParameters, bin_pack_parameters_style);
+  ASSIGN_MAGIC_ENUM(BitFieldColonSpacing);
+  ASSIGN_SAME_FIELD(BracedInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterCaseLabel);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  ASSIGN_MAGIC_ENUM(BraceWrapping.AfterControlStatement);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeLambdaBody);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeWhile);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  ASSIGN_SAME_FIELD(BreakAdjacentStringLiterals);
+  ASSIGN_MAGIC_ENUM(BreakAfterAttributes);
+  ASSIGN_MAGIC_ENUM(BreakAfterReturnType);
+  ASSIGN_SAME_FIELD(BreakArrays);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_MAGIC_ENUM(BreakBeforeConceptDeclarations);
+  ASSIGN_MAGIC_ENUM(BreakBeforeInlineASMColon);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  NEW_FIELD(BreakBinaryOperations);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  ASSIGN_SAME_FIELD(BreakFunctionDefinitionParameters);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_MAGIC_ENUM(BreakInheritanceList);
+  ASSIGN_MAGIC_ENUM(BreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_MAGIC_ENUM(EmptyLineAfterAccessModifier);
+  ASSIGN_MAGIC_ENUM(EmptyLineBeforeAccessModifier);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.IncludeBlocks);
+  ASSIGN_INCLUDE_CATEGORY3(IncludeStyle.IncludeCategories);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainRegex);
+  ASSIGN_SAME_FIELD(IncludeStyle.IncludeIsMainSourceRegex);
+  ASSIGN_MAGIC_ENUM(IncludeStyle.MainIncludeChar);
+  ASSIGN_SAME_FIELD(IfMacros);
+  ASSIGN_SAME_FIELD(IndentAccessModifiers);
+  ASSIGN_SAME_FIELD(IndentCaseBlocks);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  NEW_FIELD(IndentExportBlock);
+  ASSIGN_MAGIC_ENUM(IndentExternBlock);
+  ASSIGN_SAME_FIELD(IndentGotoLabels);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_SAME_FIELD(IndentRequiresClause);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_SAME_FIELD(InsertBraces);
+  ASSIGN_SAME_FIELD(InsertNewlineAtEOF);
+  ASSIGN_MAGIC_ENUM(InsertTrailingCommas);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.Binary);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.BinaryMinDigits);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.Decimal);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.DecimalMinDigits);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.Hex);
+  ASSIGN_SAME_FIELD(IntegerLiteralSeparator.HexMinDigits);
+  ASSIGN_SAME_FIELD(JavaImportGroups);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  ASSIGN_SAME_FIELD(KeepEmptyLines.AtEndOfFile);
+  ASSIGN_SAME_FIELD(KeepEmptyLines.AtStartOfBlock);
+  ASSIGN_SAME_FIELD(KeepEmptyLines.AtStartOfFile);
+  NEW_FIELD(KeepFormFeed);
+  ASSIGN_MAGIC_ENUM(LambdaBodyIndentation);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_MAGIC_ENUM(LineEnding);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(Macros);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_SAME_FIELD(NamespaceMacros);
+  ASSIGN_MAGIC_ENUM(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCBreakBeforeNestedBlockParam);
+  ASSIGN_SAME_FIELD(ObjCPropertyAttributeOrder);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_MAGIC_ENUM(PackConstructorInitializers);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  NEW_FIELD(PenaltyBreakBeforeMemberAccess);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakOpenParenthesis);
+  ASSIGN_SAME_FIELD(PenaltyBreakScopeResolution);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyIndentedWhitespace);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_SAME_FIELD(PPIndentWidth);
+  ASSIGN_MAGIC_ENUM(QualifierAlignment);
+  ASSIGN_SAME_FIELD(QualifierOrder);
+  ASSIGN_RAW_STRING_FORMAT(RawStringFormats, 19, 20);
+  ASSIGN_MAGIC_ENUM(ReferenceAlignment);
+  SWITCH_TO_ENUM(ReflowComments, reflow_comments_style);
+  ASSIGN_SAME_FIELD(RemoveBracesLLVM);
+  NEW_FIELD(RemoveEmptyLinesInUnwrappedLines);
+  ASSIGN_MAGIC_ENUM(RemoveParentheses);
+  ASSIGN_SAME_FIELD(RemoveSemicolon);
+  ASSIGN_MAGIC_ENUM(RequiresClausePosition);
+  ASSIGN_MAGIC_ENUM(RequiresExpressionIndentation);
+  ASSIGN_MAGIC_ENUM(SeparateDefinitionBlocks);
+  ASSIGN_SAME_FIELD(ShortNamespaceLines);
+  ASSIGN_SAME_FIELD(SkipMacroDefinitionBody);
+  ASSIGN_MAGIC_ENUM(SortIncludes);
+  ASSIGN_MAGIC_ENUM(SortJavaStaticImport);
+  ASSIGN_MAGIC_ENUM(SortUsingDeclarations);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterLogicalNot);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_MAGIC_ENUM(SpaceAroundPointerQualifiers);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(SpaceBeforeCaseColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeCpp11BracedList);
+  ASSIGN_SAME_FIELD(SpaceBeforeCtorInitializerColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_SAME_FIELD(SpaceBeforeJsonColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterControlStatements);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterForeachMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDeclarationName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterFunctionDefinitionName);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterIfMacros);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterOverloadedOperator);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterPlacementOperator);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterRequiresInClause);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.AfterRequiresInExpression);
+  ASSIGN_SAME_FIELD(SpaceBeforeParensOptions.BeforeNonEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpaceBeforeSquareBrackets);
+  ASSIGN_SAME_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  ASSIGN_SAME_FIELD(SpaceInEmptyBlock);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_MAGIC_ENUM(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Minimum);
+  ASSIGN_SAME_FIELD(SpacesInLineCommentPrefix.Maximum);
+  ASSIGN_MAGIC_ENUM(SpacesInParens);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.ExceptDoubleParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.InConditionalStatements);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.InCStyleCasts);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.InEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParensOptions.Other);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(StatementAttributeLikeMacros);
+  ASSIGN_SAME_FIELD(StatementMacros);
+  ASSIGN_SAME_FIELD(TableGenBreakingDAGArgOperators);
+  ASSIGN_MAGIC_ENUM(TableGenBreakInsideDAGArg);
+  ASSIGN_SAME_FIELD(TabWidth);
+  NEW_FIELD(TemplateNames);
+  ASSIGN_SAME_FIELD(TypeNames);
+  ASSIGN_SAME_FIELD(TypenameMacros);
+  ASSIGN_MAGIC_ENUM(UseTab);
+  NEW_FIELD(VariableTemplates);
+  ASSIGN_SAME_FIELD(VerilogBreakBetweenInstancePorts);
+  ASSIGN_SAME_FIELD(WhitespaceSensitiveMacros);
+  NEW_FIELD(WrapNamespaceBodyWithEmptyLines);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v19::FormatStyle &prev,
+                                                clang_v20::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v19::FormatStyle &prev,
+                                                  clang_v20::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v20
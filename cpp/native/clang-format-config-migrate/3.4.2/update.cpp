@@ -0,0 +1,73 @@
+#include "../update-helpers.h"
+#include "../3.3.0/Format.h"
+#include "../3.4.2/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v3_4 {
+
+template <clang_vx::Update Upgrade>
+void update(clang_v3_3::FormatStyle &prev, clang_v3_4::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v3_4::getPredefinedStyle(style, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "3.3";
+  std::string_view next_version = "3.4";
+
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  NEW_FIELD(PenaltyBreakComment);
+  NEW_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  NEW_FIELD(PenaltyBreakFirstLessLess);
+  NEW_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PointerBindsToType);
+  ASSIGN_SAME_FIELD(DerivePointerBinding);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  NEW_FIELD(NamespaceIndentation);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  NEW_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  NEW_FIELD(BreakConstructorInitializersBeforeComma);
+  ASSIGN_SAME_FIELD(AllowShortIfStatementsOnASingleLine);
+  NEW_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  NEW_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AlignEscapedNewlinesLeft);
+  NEW_FIELD(IndentWidth);
+  NEW_FIELD(TabWidth);
+  NEW_FIELD(ConstructorInitializerIndentWidth);
+  NEW_FIELD(AlwaysBreakTemplateDeclarations);
+  NEW_FIELD(AlwaysBreakBeforeMultilineStrings);
+  NEW_FIELD(UseTab);
+  NEW_FIELD(BreakBeforeBinaryOperators);
+  NEW_FIELD(BreakBeforeTernaryOperators);
+  NEW_FIELD(BreakBeforeBraces);
+  NEW_FIELD(Cpp11BracedListStyle);
+  NEW_FIELD(IndentFunctionDeclarationAfterType);
+  NEW_FIELD(SpacesInParentheses);
+  NEW_FIELD(SpacesInAngles);
+  NEW_FIELD(SpaceInEmptyParentheses);
+  NEW_FIELD(SpacesInCStyleCastParentheses);
+  NEW_FIELD(SpaceAfterControlStatementKeyword);
+  NEW_FIELD(SpaceBeforeAssignmentOperators);
+  NEW_FIELD(ContinuationIndentWidth);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v3_3::FormatStyle &prev,
+                                                clang_v3_4::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v3_3::FormatStyle &prev,
+                                                  clang_v3_4::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v3_4
@@ -0,0 +1,103 @@
+#include "../update-helpers.h"
+#include "../3.4.2/Format.h"
+#include "../3.5.2/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v3_5 {
+
+constexpr frozen::unordered_map<
+    bool, clang_v3_5::FormatStyle::PointerAlignmentStyle, 2>
+    pointer_alignment{
+        {false, clang_v3_5::FormatStyle::PointerAlignmentStyle::PAS_Right},
+        {true, clang_v3_5::FormatStyle::PointerAlignmentStyle::PAS_Left}};
+
+constexpr frozen::unordered_map<
+    bool, clang_v3_5::FormatStyle::SpaceBeforeParensOptions, 2>
+    space_before_parens_options{
+        {false, clang_v3_5::FormatStyle::SpaceBeforeParensOptions::SBPO_Never},
+        {true, clang_v3_5::FormatStyle::SpaceBeforeParensOptions::
+                   SBPO_ControlStatements}};
+
+template <clang_vx::Update Upgrade>
+void update(clang_v3_4::FormatStyle &prev, clang_v3_5::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v3_5::getPredefinedStyle(
+            style, clang_v3_5::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v3_4::getPredefinedStyle(style, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "3.4";
+  std::string_view next_version = "3.5";
+
+  NEW_FIELD(Language);
+  next.Language = clang_v3_5::FormatStyle::LanguageKind::LK_Cpp;
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  NEW_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  RENAME_AND_SWITCH_TO_ENUM(PointerBindsToType, PointerAlignment,
+                            pointer_alignment);
+  RENAME_FIELD(DerivePointerBinding, DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  RENAME_FIELD(IndentFunctionDeclarationAfterType, IndentWrappedFunctionNames);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  ASSIGN_SAME_FIELD(BreakConstructorInitializersBeforeComma);
+  NEW_FIELD(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  NEW_FIELD(AllowShortFunctionsOnASingleLine);
+  NEW_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AlignEscapedNewlinesLeft);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_MAGIC_ENUM(UseTab);
+  ASSIGN_SAME_FIELD(BreakBeforeBinaryOperators);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  NEW_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  RENAME_AND_SWITCH_TO_ENUM(SpaceAfterControlStatementKeyword,
+                            SpaceBeforeParens, space_before_parens_options);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  NEW_FIELD(CommentPragmas);
+  NEW_FIELD(DisableFormat);
+  NEW_FIELD(ForEachMacros);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v3_4::FormatStyle &prev,
+                                                clang_v3_5::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v3_4::FormatStyle &prev,
+                                                  clang_v3_5::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v3_5
@@ -0,0 +1,102 @@
+#include "../update-helpers.h"
+#include "../3.5.2/Format.h"
+#include "../3.6.2/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v3_6 {
+
+constexpr frozen::unordered_map<bool,
+                                clang_v3_6::FormatStyle::BinaryOperatorStyle, 2>
+    binary_operator_style{
+        {false, clang_v3_6::FormatStyle::BinaryOperatorStyle::BOS_None},
+        {true, clang_v3_6::FormatStyle::BinaryOperatorStyle::BOS_All}};
+
+template <clang_vx::Update Upgrade>
+void update(clang_v3_5::FormatStyle &prev, clang_v3_6::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v3_6::getPredefinedStyle(
+            style, clang_v3_6::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v3_5::getPredefinedStyle(
+            style, clang_v3_5::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "3.5";
+  std::string_view next_version = "3.6";
+
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  NEW_FIELD(BinPackArguments);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  ASSIGN_SAME_FIELD(BreakConstructorInitializersBeforeComma);
+  ASSIGN_SAME_FIELD(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  NEW_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  NEW_FIELD(AlignAfterOpenBracket);
+  NEW_FIELD(AlignOperands);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AlignEscapedNewlinesLeft);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  NEW_FIELD(ObjCBlockIndentWidth);
+  NEW_FIELD(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_MAGIC_ENUM(UseTab);
+  SWITCH_TO_ENUM(BreakBeforeBinaryOperators, binary_operator_style);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInAngles);
+  NEW_FIELD(SpacesInSquareBrackets);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  NEW_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v3_5::FormatStyle &prev,
+                                                clang_v3_6::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v3_5::FormatStyle &prev,
+                                                  clang_v3_6::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v3_6
@@ -0,0 +1,139 @@
+#include "../update-helpers.h"
+#include "../3.7.1/Format.h"
+#include "../3.8.1/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_v3_8 {
+
+std::ostream &
+operator<<(std::ostream &os,
+           const std::vector<clang_v3_8::FormatStyle::IncludeCategory> &vec) {
+  os << "{";
+  for (size_t i = 0; i < vec.size(); ++i) {
+    os << "Regex: " << vec[i].Regex << ", Priority: " << vec[i].Priority;
+    if (i != vec.size() - 1)
+      os << ", ";
+  }
+  os << "}";
+  return os;
+}
+
+} // namespace clang_v3_8
+
+namespace clang_update_v3_8 {
+
+constexpr frozen::unordered_map<
+    bool, clang_v3_8::FormatStyle::BracketAlignmentStyle, 2>
+    bracket_all_alignment_style{
+        {false, clang_v3_8::FormatStyle::BracketAlignmentStyle::BAS_DontAlign},
+        {true, clang_v3_8::FormatStyle::BracketAlignmentStyle::BAS_Align}};
+
+template <clang_vx::Update Upgrade>
+void update(clang_v3_7::FormatStyle &prev, clang_v3_8::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v3_8::getPredefinedStyle(
+            style, clang_v3_8::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v3_7::getPredefinedStyle(
+            style, clang_v3_7::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "3.7";
+  std::string_view next_version = "3.8";
+
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  SWITCH_TO_ENUM(AlignAfterOpenBracket, bracket_all_alignment_style);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments);
+  NEW_FIELD(AlignConsecutiveDeclarations);
+  ASSIGN_SAME_FIELD(AlignEscapedNewlinesLeft);
+  ASSIGN_SAME_FIELD(AlignOperands);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  NEW_FIELD(AlwaysBreakAfterReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  ASSIGN_SAME_FIELD(AlwaysBreakTemplateDeclarations);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  NEW_FIELD(BraceWrapping.AfterClass);
+  NEW_FIELD(BraceWrapping.AfterControlStatement);
+  NEW_FIELD(BraceWrapping.AfterEnum);
+  NEW_FIELD(BraceWrapping.AfterFunction);
+  NEW_FIELD(BraceWrapping.AfterNamespace);
+  NEW_FIELD(BraceWrapping.AfterObjCDeclaration);
+  NEW_FIELD(BraceWrapping.AfterStruct);
+  NEW_FIELD(BraceWrapping.AfterUnion);
+  NEW_FIELD(BraceWrapping.BeforeCatch);
+  NEW_FIELD(BraceWrapping.BeforeElse);
+  NEW_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_SAME_FIELD(BreakConstructorInitializersBeforeComma);
+  NEW_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  NEW_FIELD(IncludeCategories);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  NEW_FIELD(ReflowComments);
+  NEW_FIELD(SortIncludes);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_SAME_FIELD(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_MAGIC_ENUM(UseTab);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v3_7::FormatStyle &prev,
+                                                clang_v3_8::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v3_7::FormatStyle &prev,
+                                                  clang_v3_8::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v3_8
@@ -0,0 +1,200 @@
+#include "../update-helpers.h"
+#include "../6.0.1/Format.h"
+#include "../7.1.0/Format.h"
+#include <stdexcept>
+#include <string>
+
+namespace clang_update_v7 {
+
+constexpr frozen::unordered_map<
+    bool, clang_v7::FormatStyle::BreakTemplateDeclarationsStyle, 2>
+    break_template_declarations_style{
+        {false,
+         clang_v7::FormatStyle::BreakTemplateDeclarationsStyle::BTDS_MultiLine},
+        {true,
+         clang_v7::FormatStyle::BreakTemplateDeclarationsStyle::BTDS_Yes}};
+
+constexpr frozen::unordered_map<
+    bool, clang_v7::FormatStyle::BreakInheritanceListStyle, 2>
+    break_inheritance_list_style{
+        {false,
+         clang_v7::FormatStyle::BreakInheritanceListStyle::BILS_BeforeColon},
+        {true,
+         clang_v7::FormatStyle::BreakInheritanceListStyle::BILS_BeforeComma}};
+
+template <clang_vx::Update Upgrade>
+void assign(std::vector<clang_v6::FormatStyle::RawStringFormat> &old_field,
+            std::vector<clang_v7::FormatStyle::RawStringFormat> &new_field) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field.clear();
+    new_field.reserve(old_field.size());
+    for (const auto &item : old_field) {
+      new_field.emplace_back(clang_v7::FormatStyle::RawStringFormat{
+          magic_enum::enum_cast<clang_v7::FormatStyle::LanguageKind>(
+              magic_enum::enum_name(item.Language))
+              .value(),
+          {item.Delimiter},
+          {},
+          {},
+          item.BasedOnStyle});
+    }
+  } else {
+    old_field.clear();
+    old_field.reserve(new_field.size());
+    for (const auto &item : new_field) {
+      old_field.emplace_back(clang_v6::FormatStyle::RawStringFormat{
+          item.Delimiters.empty() ? "" : item.Delimiters.front(),
+          magic_enum::enum_cast<clang_v6::FormatStyle::LanguageKind>(
+              magic_enum::enum_name(item.Language))
+              .value(),
+          item.BasedOnStyle});
+      std::cout << "Warning when downgrading from version 7, fields "
+                   "RawStringFormats.EnclosingFunctions ("
+                << item.EnclosingFunctions
+                << "), RawStringFormats.CanonicalDelimiter ("
+                << item.CanonicalDelimiter << ") has been dropped.";
+      if (item.Delimiters.size() > 1) {
+        std::vector<std::string> delimiters_truncated = item.Delimiters;
+        delimiters_truncated.erase(delimiters_truncated.begin());
+        std::cout << " Values from RawStringFormats.Delimiters ("
+                  << delimiters_truncated << ") is also dropped.";
+      }
+      std::cout << "\n";
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade>
+void update(clang_v6::FormatStyle &prev, clang_v7::FormatStyle &next,
+            const std::string &style) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (!clang_v7::getPredefinedStyle(
+            style, clang_v7::FormatStyle::LanguageKind::LK_Cpp, &next)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  } else {
+    if (!clang_v6::getPredefinedStyle(
+            style, clang_v6::FormatStyle::LanguageKind::LK_Cpp, &prev)) {
+      throw std::runtime_error("Failed to load " + style + " style.");
+    }
+  }
+
+  std::string_view prev_version = "6";
+  std::string_view next_version = "7";
+
+  ASSIGN_SAME_FIELD(AccessModifierOffset);
+  ASSIGN_MAGIC_ENUM(AlignAfterOpenBracket);
+  ASSIGN_SAME_FIELD(AlignConsecutiveAssignments);
+  ASSIGN_SAME_FIELD(AlignConsecutiveDeclarations);
+  ASSIGN_MAGIC_ENUM(AlignEscapedNewlines);
+  ASSIGN_SAME_FIELD(AlignOperands);
+  ASSIGN_SAME_FIELD(AlignTrailingComments);
+  ASSIGN_SAME_FIELD(AllowAllParametersOfDeclarationOnNextLine);
+  ASSIGN_SAME_FIELD(AllowShortBlocksOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortCaseLabelsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AllowShortFunctionsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortIfStatementsOnASingleLine);
+  ASSIGN_SAME_FIELD(AllowShortLoopsOnASingleLine);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterDefinitionReturnType);
+  ASSIGN_MAGIC_ENUM(AlwaysBreakAfterReturnType);
+  ASSIGN_SAME_FIELD(AlwaysBreakBeforeMultilineStrings);
+  SWITCH_TO_ENUM(AlwaysBreakTemplateDeclarations,
+                 break_template_declarations_style);
+  ASSIGN_SAME_FIELD(BinPackArguments);
+  ASSIGN_SAME_FIELD(BinPackParameters);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBinaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakBeforeBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterClass);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterControlStatement);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterEnum);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterNamespace);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterObjCDeclaration);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterStruct);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterUnion);
+  ASSIGN_SAME_FIELD(BraceWrapping.AfterExternBlock);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeCatch);
+  ASSIGN_SAME_FIELD(BraceWrapping.BeforeElse);
+  ASSIGN_SAME_FIELD(BraceWrapping.IndentBraces);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyFunction);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyRecord);
+  ASSIGN_SAME_FIELD(BraceWrapping.SplitEmptyNamespace);
+  ASSIGN_SAME_FIELD(BreakBeforeTernaryOperators);
+  ASSIGN_MAGIC_ENUM(BreakConstructorInitializers);
+  ASSIGN_SAME_FIELD(BreakAfterJavaFieldAnnotations);
+  ASSIGN_SAME_FIELD(BreakStringLiterals);
+  ASSIGN_SAME_FIELD(ColumnLimit);
+  ASSIGN_SAME_FIELD(CommentPragmas);
+  RENAME_AND_SWITCH_TO_ENUM(BreakBeforeInheritanceComma, BreakInheritanceList,
+                            break_inheritance_list_style);
+  ASSIGN_SAME_FIELD(CompactNamespaces);
+  ASSIGN_SAME_FIELD(ConstructorInitializerAllOnOneLineOrOnePerLine);
+  ASSIGN_SAME_FIELD(ConstructorInitializerIndentWidth);
+  ASSIGN_SAME_FIELD(ContinuationIndentWidth);
+  ASSIGN_SAME_FIELD(Cpp11BracedListStyle);
+  ASSIGN_SAME_FIELD(DerivePointerAlignment);
+  ASSIGN_SAME_FIELD(DisableFormat);
+  ASSIGN_SAME_FIELD(ExperimentalAutoDetectBinPacking);
+  ASSIGN_SAME_FIELD(FixNamespaceComments);
+  ASSIGN_SAME_FIELD(ForEachMacros);
+  ASSIGN_INCLUDE_CATEGORY_RENAME(IncludeCategories,
+                                 IncludeStyle.IncludeCategories);
+  RENAME_MAGIC_ENUM(IncludeBlocks, IncludeStyle.IncludeBlocks);
+  RENAME_FIELD(IncludeIsMainRegex, IncludeStyle.IncludeIsMainRegex);
+  ASSIGN_SAME_FIELD(IndentCaseLabels);
+  ASSIGN_MAGIC_ENUM(IndentPPDirectives);
+  ASSIGN_SAME_FIELD(IndentWidth);
+  ASSIGN_SAME_FIELD(IndentWrappedFunctionNames);
+  ASSIGN_MAGIC_ENUM(JavaScriptQuotes);
+  ASSIGN_SAME_FIELD(JavaScriptWrapImports);
+  ASSIGN_SAME_FIELD(KeepEmptyLinesAtTheStartOfBlocks);
+  ASSIGN_MAGIC_ENUM(Language);
+  ASSIGN_SAME_FIELD(MacroBlockBegin);
+  ASSIGN_SAME_FIELD(MacroBlockEnd);
+  ASSIGN_SAME_FIELD(MaxEmptyLinesToKeep);
+  ASSIGN_MAGIC_ENUM(NamespaceIndentation);
+  NEW_FIELD(ObjCBinPackProtocolList);
+  ASSIGN_SAME_FIELD(ObjCBlockIndentWidth);
+  ASSIGN_SAME_FIELD(ObjCSpaceAfterProperty);
+  ASSIGN_SAME_FIELD(ObjCSpaceBeforeProtocolList);
+  ASSIGN_SAME_FIELD(PenaltyBreakAssignment);
+  ASSIGN_SAME_FIELD(PenaltyBreakBeforeFirstCallParameter);
+  ASSIGN_SAME_FIELD(PenaltyBreakComment);
+  ASSIGN_SAME_FIELD(PenaltyBreakFirstLessLess);
+  ASSIGN_SAME_FIELD(PenaltyBreakString);
+  NEW_FIELD(PenaltyBreakTemplateDeclaration);
+  ASSIGN_SAME_FIELD(PenaltyExcessCharacter);
+  ASSIGN_SAME_FIELD(PenaltyReturnTypeOnItsOwnLine);
+  ASSIGN_MAGIC_ENUM(PointerAlignment);
+  assign<Upgrade>(prev.RawStringFormats, next.RawStringFormats);
+  ASSIGN_SAME_FIELD(ReflowComments);
+  ASSIGN_SAME_FIELD(SortIncludes);
+  ASSIGN_SAME_FIELD(SortUsingDeclarations);
+  ASSIGN_SAME_FIELD(SpaceAfterCStyleCast);
+  ASSIGN_SAME_FIELD(SpaceAfterTemplateKeyword);
+  ASSIGN_SAME_FIELD(SpaceBeforeAssignmentOperators);
+  NEW_FIELD(SpaceBeforeCpp11BracedList);
+  NEW_FIELD(SpaceBeforeCtorInitializerColon);
+  NEW_FIELD(SpaceBeforeInheritanceColon);
+  ASSIGN_MAGIC_ENUM(SpaceBeforeParens);
+  NEW_FIELD(SpaceBeforeRangeBasedForLoopColon);
+  ASSIGN_SAME_FIELD(SpaceInEmptyParentheses);
+  ASSIGN_SAME_FIELD(SpacesBeforeTrailingComments);
+  ASSIGN_SAME_FIELD(SpacesInAngles);
+  ASSIGN_SAME_FIELD(SpacesInContainerLiterals);
+  ASSIGN_SAME_FIELD(SpacesInCStyleCastParentheses);
+  ASSIGN_SAME_FIELD(SpacesInParentheses);
+  ASSIGN_SAME_FIELD(SpacesInSquareBrackets);
+  ASSIGN_MAGIC_ENUM(Standard);
+  ASSIGN_SAME_FIELD(TabWidth);
+  ASSIGN_MAGIC_ENUM(UseTab);
+}
+
+template void update<clang_vx::Update::UPGRADE>(clang_v6::FormatStyle &prev,
+                                                clang_v7::FormatStyle &next,
+                                                const std::string &style);
+template void update<clang_vx::Update::DOWNGRADE>(clang_v6::FormatStyle &prev,
+                                                  clang_v7::FormatStyle &next,
+                                                  const std::string &style);
+
+} // namespace clang_update_v7
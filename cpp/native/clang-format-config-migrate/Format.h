@@ -44,6 +44,8 @@ enum class Version {
   V21
 };
 
+enum class Update { DOWNGRADE, UPGRADE };
+
 std::vector<Version> getCompatibleVersion(const std::string &config);
 
 std::string versionEnumToString(Version version);
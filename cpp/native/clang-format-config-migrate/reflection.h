@@ -0,0 +1,148 @@
+#pragma once
+
+#include "10.0.1/Format.h"
+#include "11.1.0/Format.h"
+#include "12.0.1/Format.h"
+#include "13.0.1/Format.h"
+#include "14.0.6/Format.h"
+#include "15.0.7/Format.h"
+#include "16.0.6/Format.h"
+#include "17.0.6/Format.h"
+#include "18.1.8/Format.h"
+#include "19.1.6/Format.h"
+#include "20.1.6/Format.h"
+#include "21.1.8/Format.h"
+#include "3.3.0/Format.h"
+#include "3.4.2/Format.h"
+#include "3.5.2/Format.h"
+#include "3.6.2/Format.h"
+#include "3.7.1/Format.h"
+#include "3.8.1/Format.h"
+#include "3.9.1/Format.h"
+#include "4.0.1/Format.h"
+#include "5.0.2/Format.h"
+#include "6.0.1/Format.h"
+#include "7.1.0/Format.h"
+#include "8.0.1/Format.h"
+#include "9.0.1/Format.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+// Compile-time description of the FormatStyle of every version. Tables are
+// generated by clang_format_parser in NN/reflection.inc.
+namespace clang_vx::reflection {
+
+enum class Category : uint8_t {
+  Bool,
+  Signed,
+  Unsigned,
+  Enum,
+  String,
+  Vector,
+  Optional,
+  Record,
+  Other
+};
+
+struct Field {
+  std::string_view name;
+  std::string_view yaml_key;
+  size_t offset;
+  Category category;
+};
+
+template <typename T> struct EnumValue {
+  std::string_view name;
+  T value;
+};
+
+// Record<T>::fields: the public fields of T in declaration order.
+template <typename T> struct Record;
+
+// Enum<T>::values: the values of T in declaration order.
+template <typename T> struct Enum;
+
+// Canonical index of a field of T, or the number of fields if not found.
+template <typename T> constexpr size_t fieldIndex(std::string_view name) {
+  const auto &fields = Record<T>::fields;
+  for (size_t i = 0; i < fields.size(); ++i) {
+    if (fields[i].name == name) {
+      return i;
+    }
+  }
+  return fields.size();
+}
+
+// Canonical index of a field of T from its YAML key, or the number of fields
+// if not found.
+template <typename T> constexpr size_t yamlKeyIndex(std::string_view key) {
+  const auto &fields = Record<T>::fields;
+  for (size_t i = 0; i < fields.size(); ++i) {
+    if (fields[i].yaml_key == key) {
+      return i;
+    }
+  }
+  return fields.size();
+}
+
+// Address of the field of canonical index in style.
+template <typename T>
+const void *fieldAddress(const T &style, size_t index) {
+  return reinterpret_cast<const char *>(&style) +
+         Record<T>::fields[index].offset;
+}
+
+template <typename T> constexpr std::string_view enumName(T value) {
+  for (const auto &item : Enum<T>::values) {
+    if (item.value == value) {
+      return item.name;
+    }
+  }
+  return {};
+}
+
+template <typename T>
+constexpr std::optional<T> enumCast(std::string_view name) {
+  for (const auto &item : Enum<T>::values) {
+    if (item.name == name) {
+      return item.value;
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace clang_vx::reflection
+
+// offsetof is used on FormatStyle that is not standard-layout because of its
+// std::string. It's supported by GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#include "3.3.0/reflection.inc"
+#include "3.4.2/reflection.inc"
+#include "3.5.2/reflection.inc"
+#include "3.6.2/reflection.inc"
+#include "3.7.1/reflection.inc"
+#include "3.8.1/reflection.inc"
+#include "3.9.1/reflection.inc"
+#include "4.0.1/reflection.inc"
+#include "5.0.2/reflection.inc"
+#include "6.0.1/reflection.inc"
+#include "7.1.0/reflection.inc"
+#include "8.0.1/reflection.inc"
+#include "9.0.1/reflection.inc"
+#include "10.0.1/reflection.inc"
+#include "11.1.0/reflection.inc"
+#include "12.0.1/reflection.inc"
+#include "13.0.1/reflection.inc"
+#include "14.0.6/reflection.inc"
+#include "15.0.7/reflection.inc"
+#include "16.0.6/reflection.inc"
+#include "17.0.6/reflection.inc"
+#include "18.1.8/reflection.inc"
+#include "19.1.6/reflection.inc"
+#include "20.1.6/reflection.inc"
+#include "21.1.8/reflection.inc"
+#pragma GCC diagnostic pop
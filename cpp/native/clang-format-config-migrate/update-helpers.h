@@ -0,0 +1,486 @@
+#pragma once
+
+#include "Format.h"
+#include <array>
+#include <frozen/unordered_map.h>
+#include <iostream>
+#include <magic_enum/magic_enum.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Helpers and macros of the migration between two consecutive versions.
+// Each hop is in NN/update.cpp and only includes the Format.h of its two
+// versions.
+
+#define XSTR(S) STR(S)
+#define STR(S) #S
+
+inline std::ostream &operator<<(std::ostream &os,
+                                const std::vector<std::string> &vec) {
+  os << "{";
+  for (size_t i = 0; i < vec.size(); ++i) {
+    os << vec[i];
+    if (i != vec.size() - 1)
+      os << ", ";
+  }
+  os << "}";
+  return os;
+}
+
+namespace clang_update {
+
+template <typename K, typename V, size_t SIZE>
+std::optional<K> getKeyFromValue(const frozen::unordered_map<K, V, SIZE> &myMap,
+                                 const V &valueToFind) {
+  for (const auto &pair : myMap) {
+    if (pair.second == valueToFind) {
+      return pair.first;
+    }
+  }
+  return std::nullopt;
+}
+
+template <typename T, typename U>
+void assignWithWarning(std::string_view old_field_name, T &old_field,
+                       std::string_view new_field_name, U &new_field,
+                       U new_value, std::string_view version) {
+  if (new_field != new_value) {
+    std::cout << "Warning when migrating to version " << version
+              << ". Overriding field " << new_field_name << " from value "
+              << new_field << " to " << new_value << " based on field "
+              << old_field_name << " with value " << old_field
+              << " from previous version.\n";
+    new_field = new_value;
+  }
+}
+
+template <clang_vx::Update Upgrade, typename T, typename U>
+void renameField(std::string_view old_field_name, T &old_field,
+                 std::string_view new_field_name, U &new_field,
+                 std::string_view version) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    std::cout << "Info when upgrading to version " << version << ". Old field "
+              << old_field_name << " has been renamed to " << new_field_name
+              << ".";
+    new_field = old_field;
+  } else {
+    std::cout << "Info when downgrading to version " << version
+              << ". New field " << new_field_name << " has been renamed to "
+              << old_field_name << ".\n";
+    old_field = new_field;
+  }
+}
+
+template <typename T, typename U, size_t SIZE>
+void renameAndSwitchToEnumUpgrade(std::string_view old_field_name, T &old_field,
+                                  std::string_view new_field_name, U &new_field,
+                                  const frozen::unordered_map<T, U, SIZE> &map,
+                                  std::string_view version) {
+  bool renamed = old_field_name != new_field_name;
+  bool prefix = false;
+  if (renamed) {
+    std::cout << "Info when upgrading to version " << version << ". Old field "
+              << old_field_name << " has been renamed to " << new_field_name
+              << ".";
+    prefix = true;
+  }
+  if constexpr (std::is_enum_v<U>) {
+    for (auto ls1 : magic_enum::enum_values<U>()) {
+      if (!getKeyFromValue(map, ls1)) {
+        if (!prefix) {
+          std::cout << "Info when upgrading to version " << version << ".";
+          prefix = true;
+        }
+        std::cout << "\nField " << new_field_name << " has a new value "
+                  << magic_enum::enum_name(ls1) << ".";
+      }
+    }
+  }
+  new_field = map.at(old_field);
+  std::cout << "\n";
+}
+
+template <typename T, typename U, size_t SIZE>
+void renameAndSwitchToEnumDowngrade(
+    std::string_view old_field_name, T &old_field,
+    std::string_view new_field_name, U &new_field,
+    const frozen::unordered_map<T, U, SIZE> &map, std::string_view version) {
+  bool renamed = old_field_name != new_field_name;
+  std::optional<T> old_value = getKeyFromValue(map, new_field);
+  if (!old_value) {
+    std::cout << "Error when downgrading from version " << version << ".";
+    if (renamed) {
+      std::cout << " New field " << new_field_name << " has been renamed to "
+                << old_field_name << ".";
+    }
+    std::cout << " Can't find a match of the new value ";
+    if constexpr (std::is_enum_v<U>) {
+      std::cout << magic_enum::enum_name(new_field);
+    } else {
+      std::cout << new_field;
+    }
+    std::cout << " to old field. Default old value " << old_field
+              << " has been kept.\n";
+  } else if (old_field != *old_value) {
+    std::cout << "Info when downgrading from version " << version << ".";
+    if (renamed) {
+      std::cout << " New field " << new_field_name << " has been renamed to "
+                << old_field_name << ".";
+    }
+    std::cout << " Overriding old field from value " << old_field << " to "
+              << *old_value << " based on new value ";
+    if constexpr (std::is_enum_v<U>) {
+      std::cout << magic_enum::enum_name(new_field);
+    } else {
+      std::cout << new_field;
+    }
+    std::cout << ".\n";
+    old_field = *old_value;
+  } else {
+    std::cout << "Info when downgrading to version " << version << ".";
+    if (renamed) {
+      std::cout << " New field " << new_field_name << " has been renamed to "
+                << old_field_name << ".";
+    }
+    std::cout << "\n";
+  }
+  if constexpr (std::is_enum_v<U>) {
+    for (auto ls1 : magic_enum::enum_values<U>()) {
+      if (!getKeyFromValue(map, ls1)) {
+        std::cout << "Field " << old_field_name << " has dropped value "
+                  << magic_enum::enum_name(ls1) << ".\n";
+      }
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade = clang_vx::Update::UPGRADE, typename T>
+void newField(std::string_view field_name, std::string_view version,
+              const T &field_value) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    std::cout << "Info when upgrading to";
+  } else {
+    std::cout << "Warning when downgrading from";
+  }
+  std::cout << " version " << version << ". ";
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    std::cout << "New";
+  } else {
+    std::cout << "Removed";
+  }
+  std::cout << " field " << field_name << " with value ";
+  if constexpr (std::is_enum_v<T>) {
+    std::cout << magic_enum::enum_name(field_value);
+  } else {
+    std::cout << field_value;
+  }
+  std::cout << ".\n";
+}
+
+template <clang_vx::Update Upgrade = clang_vx::Update::UPGRADE, typename T>
+void newField(std::string_view field_name, std::string_view version,
+              const std::optional<T> &field_value) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    std::cout << "Info when upgrading to";
+  } else {
+    std::cout << "Warning when downgrading from";
+  }
+  std::cout << " version " << version << ". ";
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    std::cout << "New";
+  } else {
+    std::cout << "Removed";
+  }
+  std::cout << " field " << field_name << " with value ";
+  if (!field_value) {
+    std::cout << "undefined";
+  } else {
+    std::cout << *field_value;
+  }
+  std::cout << ".\n";
+}
+
+template <clang_vx::Update Upgrade = clang_vx::Update::UPGRADE, typename T,
+          typename U>
+void assignSameField(T &old_field, U &new_field) {
+  static_assert(std::is_same_v<T, U>);
+  static_assert(!std::is_enum_v<T>);
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field = old_field;
+  } else {
+    old_field = new_field;
+  }
+}
+
+template <clang_vx::Update Upgrade = clang_vx::Update::UPGRADE, typename T,
+          typename U>
+void assignRemoveOptional(T &old_field, U &new_field, U default_value) {
+  static_assert(std::is_same_v<T, std::optional<U>> ||
+                std::is_same_v<T, std::optional<std::make_unsigned_t<U>>> ||
+                std::is_same_v<T, std::optional<std::make_signed_t<U>>>);
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    if (old_field.has_value()) {
+      new_field = static_cast<U>(*old_field);
+    } else {
+      new_field = default_value;
+    }
+  } else {
+    if (new_field == default_value) {
+      old_field = std::nullopt;
+    } else {
+      old_field = static_cast<unsigned>(new_field);
+    }
+  }
+}
+
+template <typename U, size_t SIZE> struct EnumConversion {
+  std::array<U, SIZE> values{};
+  std::array<bool, SIZE> found{};
+};
+
+// For each value of T, the value of U with the same name.
+template <typename T, typename U> constexpr auto makeEnumConversion() {
+  constexpr auto &from = magic_enum::enum_values<T>();
+  EnumConversion<U, from.size()> retval{};
+  for (size_t i = 0; i < from.size(); ++i) {
+    if (const auto value =
+            magic_enum::enum_cast<U>(magic_enum::enum_name(from[i]))) {
+      retval.values[i] = *value;
+      retval.found[i] = true;
+    }
+  }
+  return retval;
+}
+
+template <typename T, typename U> constexpr size_t countEnumRemoved() {
+  const auto conversion = makeEnumConversion<T, U>();
+  size_t retval = 0;
+  for (const bool found : conversion.found) {
+    retval += found ? 0 : 1;
+  }
+  return retval;
+}
+
+// Values of T without a value of the same name in U.
+template <typename T, typename U> constexpr auto makeEnumRemoved() {
+  constexpr auto &from = magic_enum::enum_values<T>();
+  const auto conversion = makeEnumConversion<T, U>();
+  std::array<T, countEnumRemoved<T, U>()> retval{};
+  size_t j = 0;
+  for (size_t i = 0; i < from.size(); ++i) {
+    if (!conversion.found[i]) {
+      retval[j++] = from[i];
+    }
+  }
+  return retval;
+}
+
+// Migration of enum T to enum U by name, computed at compile time. A
+// conversion is an array access and enums with the same values have nothing
+// to report.
+template <typename T, typename U> struct EnumMigration {
+  static constexpr auto conversion = makeEnumConversion<T, U>();
+  static constexpr auto removed = makeEnumRemoved<T, U>();
+
+  static std::optional<U> convert(T value) {
+    const std::optional<size_t> index = magic_enum::enum_index(value);
+    if (!index || !conversion.found[*index]) {
+      return std::nullopt;
+    }
+    return conversion.values[*index];
+  }
+};
+
+template <clang_vx::Update Upgrade, typename T, typename U>
+void assignMagicEnum(T &old_field, U &new_field, std::string_view version) {
+  using Forward = EnumMigration<T, U>;
+  using Backward = EnumMigration<U, T>;
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    for (const T ls1 : Forward::removed) {
+      if (old_field == ls1) {
+        std::cout << "Error when upgrading to version " << version << ". Enum "
+                  << magic_enum::enum_type_name<T>()
+                  << "::" << magic_enum::enum_name(ls1)
+                  << " is removed and was used.\n";
+      } else {
+        std::cout << "Info when upgrading to version " << version << ". Enum "
+                  << magic_enum::enum_type_name<T>()
+                  << "::" << magic_enum::enum_name(ls1)
+                  << " is removed but was not used.\n";
+      }
+    }
+    for (const U ls2 : Backward::removed) {
+      std::cout << "Info when upgrading to version " << version << ". Enum "
+                << magic_enum::enum_type_name<U>() << " have a new value "
+                << magic_enum::enum_name(ls2) << ".\n";
+    }
+    new_field = Forward::convert(old_field).value();
+  } else {
+    bool missing_enum = false;
+    for (const U ls1 : Backward::removed) {
+      if (new_field == ls1) {
+        missing_enum = true;
+        std::cout << "Error when downgrading from version " << version
+                  << ". Enum " << magic_enum::enum_type_name<U>()
+                  << "::" << magic_enum::enum_name(ls1)
+                  << " is removed and was used. Value "
+                  << magic_enum::enum_name(old_field) << " will be used\n";
+      } else {
+        std::cout << "Info when downgrading from version " << version
+                  << ". Enum " << magic_enum::enum_type_name<U>()
+                  << "::" << magic_enum::enum_name(ls1)
+                  << " is removed but was not used.\n";
+      }
+    }
+    for (const T ls2 : Forward::removed) {
+      std::cout << "Info when downgrading to version " << version << ". Enum "
+                << magic_enum::enum_type_name<T>() << " had an old value "
+                << magic_enum::enum_name(ls2) << ".\n";
+    }
+    if (!missing_enum) {
+      old_field = Backward::convert(new_field).value();
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade, typename T, typename U>
+void assignIncludeCategory(std::vector<T> &old_field,
+                           std::vector<U> &new_field) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field.clear();
+    new_field.reserve(old_field.size());
+    for (const auto &item : old_field) {
+      new_field.emplace_back(U{item.Regex, item.Priority});
+    }
+  } else {
+    old_field.clear();
+    old_field.reserve(new_field.size());
+    for (const auto &item : new_field) {
+      old_field.emplace_back(T{item.Regex, item.Priority});
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade, typename T, typename U>
+void assignIncludeCategory2(std::vector<T> &old_field,
+                            std::vector<U> &new_field) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field.clear();
+    new_field.reserve(old_field.size());
+    for (const auto &item : old_field) {
+      new_field.emplace_back(U{item.Regex, item.Priority, item.SortPriority});
+    }
+  } else {
+    old_field.clear();
+    old_field.reserve(new_field.size());
+    for (const auto &item : new_field) {
+      old_field.emplace_back(T{item.Regex, item.Priority, item.SortPriority});
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade, typename T, typename U>
+void assignIncludeCategory3(std::vector<T> &old_field,
+                            std::vector<U> &new_field) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field.clear();
+    new_field.reserve(old_field.size());
+    for (const auto &item : old_field) {
+      new_field.emplace_back(U{item.Regex, item.Priority, item.SortPriority,
+                               item.RegexIsCaseSensitive});
+    }
+  } else {
+    old_field.clear();
+    old_field.reserve(new_field.size());
+    for (const auto &item : new_field) {
+      old_field.emplace_back(T{item.Regex, item.Priority, item.SortPriority,
+                               item.RegexIsCaseSensitive});
+    }
+  }
+}
+
+template <clang_vx::Update Upgrade, typename T, typename U>
+void assignRawStringFormat(
+    std::vector<typename T::RawStringFormat> &old_field,
+    std::vector<typename U::RawStringFormat> &new_field) {
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {
+    new_field.clear();
+    new_field.reserve(old_field.size());
+    for (const auto &item : old_field) {
+      new_field.emplace_back(typename U::RawStringFormat{
+          EnumMigration<typename T::LanguageKind, typename U::LanguageKind>::
+              convert(item.Language)
+                  .value(),
+          item.Delimiters, item.EnclosingFunctions, item.CanonicalDelimiter,
+          item.BasedOnStyle});
+    }
+  } else {
+    old_field.clear();
+    old_field.reserve(new_field.size());
+    for (const auto &item : new_field) {
+      old_field.emplace_back(typename T::RawStringFormat{
+          EnumMigration<typename U::LanguageKind, typename T::LanguageKind>::
+              convert(item.Language)
+                  .value(),
+          item.Delimiters, item.EnclosingFunctions, item.CanonicalDelimiter,
+          item.BasedOnStyle});
+    }
+  }
+}
+
+} // namespace clang_update
+
+#define ASSIGN_SAME_FIELD(FIELD)                                               \
+  clang_update::assignSameField<Upgrade>(prev.FIELD, next.FIELD)
+#define ASSIGN_REMOVE_OPTIONAL(FIELD, DEFAULT_VALUE)                           \
+  clang_update::assignRemoveOptional<Upgrade>(prev.FIELD, next.FIELD,          \
+                                              DEFAULT_VALUE)
+#define ASSIGN_MAGIC_ENUM(FIELD)                                               \
+  clang_update::assignMagicEnum<Upgrade>(prev.FIELD, next.FIELD, next_version)
+#define RENAME_MAGIC_ENUM(OLD_FIELD, NEW_FIELD)                                \
+  clang_update::assignMagicEnum<Upgrade>(prev.OLD_FIELD, next.NEW_FIELD,       \
+                                         next_version)
+#define NEW_FIELD(FIELD)                                                       \
+  clang_update::newField<Upgrade>(STR(FIELD), next_version, next.FIELD)
+#define RENAME_AND_SWITCH_TO_ENUM(OLD_FIELD, NEW_FIELD, MAP)                   \
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {                        \
+    clang_update::renameAndSwitchToEnumUpgrade(                                \
+        STR(OLD_FIELD), prev.OLD_FIELD, STR(NEW_FIELD), next.NEW_FIELD, MAP,   \
+        next_version);                                                         \
+  } else {                                                                     \
+    clang_update::renameAndSwitchToEnumDowngrade(                              \
+        STR(OLD_FIELD), prev.OLD_FIELD, STR(NEW_FIELD), next.NEW_FIELD, MAP,   \
+        next_version);                                                         \
+  }                                                                            \
+  static_assert(true)
+#define SWITCH_TO_ENUM(FIELD, MAP)                                             \
+  if constexpr (Upgrade == clang_vx::Update::UPGRADE) {                        \
+    clang_update::renameAndSwitchToEnumUpgrade(STR(FIELD), prev.FIELD,         \
+                                               STR(FIELD), next.FIELD, MAP,    \
+                                               next_version);                  \
+  } else {                                                                     \
+    clang_update::renameAndSwitchToEnumDowngrade(STR(FIELD), prev.FIELD,       \
+                                                 STR(FIELD), next.FIELD, MAP,  \
+                                                 next_version);                \
+  }                                                                            \
+  static_assert(true)
+#define RENAME_FIELD(OLD_FIELD, NEW_FIELD)                                     \
+  clang_update::renameField<Upgrade>(STR(OLD_FIELD), prev.OLD_FIELD,           \
+                                     STR(NEW_FIELD), next.NEW_FIELD,           \
+                                     next_version)
+#define ASSIGN_INCLUDE_CATEGORY(FIELD)                                         \
+  clang_update::assignIncludeCategory<Upgrade>(prev.FIELD, next.FIELD)
+#define ASSIGN_INCLUDE_CATEGORY_RENAME(OLD_FIELD, NEW_FIELD)                   \
+  clang_update::assignIncludeCategory<Upgrade>(prev.OLD_FIELD, next.NEW_FIELD)
+#define ASSIGN_INCLUDE_CATEGORY2(FIELD)                                        \
+  clang_update::assignIncludeCategory2<Upgrade>(prev.FIELD, next.FIELD)
+#define ASSIGN_INCLUDE_CATEGORY3(FIELD)                                        \
+  clang_update::assignIncludeCategory3<Upgrade>(prev.FIELD, next.FIELD)
+#define ASSIGN_RAW_STRING_FORMAT(FIELD, OLD_VERSION, NEW_VERSION)              \
+  clang_update::assignRawStringFormat<Upgrade,                                 \
+                                      clang_v##OLD_VERSION::FormatStyle,       \
+                                      clang_v##NEW_VERSION::FormatStyle>(      \
+      prev.FIELD, next.FIELD)
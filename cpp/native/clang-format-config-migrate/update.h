@@ -26,7 +26,6 @@
 #include "Format.h"
 
 namespace clang_vx {
-enum class Update { DOWNGRADE, UPGRADE };
 
 std::string updateTo(Version vstart, Version vend, const std::string &data,
                      const std::string &default_style, bool skip_same_value);
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <atomic>
 #include <clang/AST/ASTConsumer.h>
 #include <clang/AST/ASTContext.h>
 #include <clang/AST/Decl.h>
@@ -8,17 +10,31 @@
 #include <clang/Basic/Specifiers.h>
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Frontend/FrontendAction.h>
+#include <clang/Frontend/Utils.h>
 #include <clang/Tooling/Tooling.h>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <frozen/bits/elsa.h>
 #include <frozen/bits/hash_string.h>
 #include <frozen/unordered_map.h>
 #include <fstream>
+#include <iostream>
+#include <iterator>
+#include <llvm/ADT/StringRef.h>
 #include <llvm/Support/ErrorOr.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/xxhash.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <regex>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility> // IWYU pragma: keep
 #include <vector>
 
@@ -49,20 +65,97 @@ namespace {
 constexpr frozen::unordered_map<std::string_view, int, 3> type_str_to_size{
     {"int", -32}, {"unsigned int", 32}, {"int8_t", -8}};
 
+// One Format.h to parse.
+struct Job {
+  std::string header;
+  std::vector<std::string> args;
+  // embind bindings.
+  std::string output;
+  // Optional constexpr reflection tables.
+  std::string reflection;
+  // Optional Format.cpp with the YAML keys of the fields.
+  std::string yaml;
+};
+
+// YAML key by (style name of the mapped struct, member path of the field).
+// The member path is "Field", or "Member.Field" for a field of a member.
+using YamlKeys = std::map<std::pair<std::string, std::string>, std::string>;
+
+bool isStyle(const std::string &name) {
+  return name.find("::FormatStyle") != std::string::npos ||
+         name.find("::IncludeStyle") != std::string::npos;
+}
+
+// Name from FormatStyle or IncludeStyle without the namespaces:
+// clang_v21::format::FormatStyle::BraceWrappingFlags gives
+// FormatStyle::BraceWrappingFlags. Empty if name is not a style.
+std::string styleName(const std::string &name) {
+  size_t retval = std::string::npos;
+  for (const char *style : {"FormatStyle", "IncludeStyle"}) {
+    for (size_t pos = name.find(style); pos != std::string::npos;
+         pos = name.find(style, pos + 1)) {
+      if (pos == 0 || name[pos - 1] == ':') {
+        retval = std::min(retval, pos);
+        break;
+      }
+    }
+  }
+  return retval == std::string::npos ? std::string{} : name.substr(retval);
+}
+
+// clang_vx::reflection::Category of a field.
+std::string_view fieldCategory(QualType type, const ASTContext &context) {
+  type = type.getCanonicalType();
+  if (type->isBooleanType()) {
+    return "Bool";
+  }
+  if (type->isEnumeralType()) {
+    return "Enum";
+  }
+  if (type->isIntegralType(context)) {
+    return type->isSignedIntegerType() ? "Signed" : "Unsigned";
+  }
+  if (const CXXRecordDecl *record = type->getAsCXXRecordDecl()) {
+    const std::string name = record->getNameAsString();
+    if (name == "basic_string") {
+      return "String";
+    }
+    if (name == "vector") {
+      return "Vector";
+    }
+    if (name == "optional") {
+      return "Optional";
+    }
+    return "Record";
+  }
+  return "Other";
+}
+
 } // namespace
 
 class FindNamedClassVisitor
     : public RecursiveASTVisitor<FindNamedClassVisitor> {
 public:
-  explicit FindNamedClassVisitor(ASTContext *context, std::string_view name)
-      : _context(context),
-        _emscripten_file(std::string{name.data(), name.size()}) {}
+  explicit FindNamedClassVisitor(
+      ASTContext *context, const Job &job, const YamlKeys &yaml_keys)
+      : _context(context), _emscripten_file(job.output), _yaml_keys(yaml_keys) {
+    if (!job.reflection.empty()) {
+      _reflection_file.open(job.reflection);
+      _reflection_file << "// Generated by clang_format_parser from "
+                       << llvm::sys::path::filename(job.header).str()
+                       << ". Do not edit.\n\n"
+                       << "namespace clang_vx::reflection {\n\n";
+    }
+  }
+
+  ~FindNamedClassVisitor() {
+    if (_reflection_file.is_open()) {
+      _reflection_file << "} // namespace clang_vx::reflection\n";
+    }
+  }
 
   bool VisitCXXRecordDecl(CXXRecordDecl *declaration) {
-    if ((declaration->getQualifiedNameAsString().find("::FormatStyle") !=
-             std::string::npos ||
-         declaration->getQualifiedNameAsString().find("::IncludeStyle") !=
-             std::string::npos) &&
+    if (isStyle(declaration->getQualifiedNameAsString()) &&
         (declaration->getDeclContext()->isNamespace() ||
          declaration->getAccess() == AccessSpecifier::AS_public)) {
       _emscripten_file << "emscripten::class_<"
@@ -98,16 +191,21 @@ public:
         }
       }
       _emscripten_file << ";\n\n";
+      // The YAML key of a field of a member needs every record, so the
+      // tables are written by writeRecordTables.
+      if (_reflection_file.is_open() &&
+          declaration->isThisDeclarationADefinition() &&
+          !declaration->isDependentType()) {
+        _records.push_back(declaration);
+      }
     }
     return true;
   }
 
   bool VisitEnumDecl(EnumDecl *declaration) {
-    if (declaration->getQualifiedNameAsString().find("::FormatStyle") !=
-            std::string::npos ||
-        declaration->getQualifiedNameAsString().find("::IncludeStyle") !=
-                std::string::npos &&
-            declaration->getAccess() == AccessSpecifier::AS_public) {
+    if (isStyle(declaration->getQualifiedNameAsString()) &&
+        (declaration->getDeclContext()->isNamespace() ||
+         declaration->getAccess() == AccessSpecifier::AS_public)) {
       _emscripten_file << "emscripten::enum_<"
                        << declaration->getQualifiedNameAsString() << ">(\""
                        << declaration->getNameAsString()
@@ -119,13 +217,94 @@ public:
                          << field->getQualifiedNameAsString() << ")";
       }
       _emscripten_file << ";\n\n";
+      writeEnumTable(declaration);
     }
     return true;
   }
 
+  // Record<T> of every record visited.
+  void writeRecordTables() {
+    for (const CXXRecordDecl *record : _records) {
+      writeRecordTable(record);
+    }
+  }
+
 private:
   ASTContext *_context;
   std::ofstream _emscripten_file;
+  std::ofstream _reflection_file;
+  const YamlKeys &_yaml_keys;
+  std::vector<const CXXRecordDecl *> _records;
+
+  // YAML key of field in declaration. Format.cpp maps it in the
+  // MappingTraits of declaration, or of a record with a member of type
+  // declaration (Style.IncludeStyle.IncludeBlocks). Else it is field.
+  std::string yamlKey(const CXXRecordDecl *declaration,
+                      const std::string &field) const {
+    const auto direct = _yaml_keys.find(
+        {styleName(declaration->getQualifiedNameAsString()), field});
+    if (direct != _yaml_keys.end()) {
+      return direct->second;
+    }
+    for (const CXXRecordDecl *record : _records) {
+      for (const auto *member : record->fields()) {
+        const CXXRecordDecl *type = member->getType()->getAsCXXRecordDecl();
+        if (type == nullptr ||
+            type->getCanonicalDecl() != declaration->getCanonicalDecl()) {
+          continue;
+        }
+        const auto nested =
+            _yaml_keys.find({styleName(record->getQualifiedNameAsString()),
+                             member->getNameAsString() + "." + field});
+        if (nested != _yaml_keys.end()) {
+          return nested->second;
+        }
+      }
+    }
+    return field;
+  }
+
+  // Record<T>::fields in declaration order. The index of a field is its
+  // canonical index.
+  void writeRecordTable(const CXXRecordDecl *declaration) {
+    const std::string name = declaration->getQualifiedNameAsString();
+    size_t count = 0;
+    std::ostringstream fields;
+    for (const auto *field : declaration->fields()) {
+      if (field->getAccess() != AccessSpecifier::AS_public) {
+        continue;
+      }
+      const std::string field_name = field->getNameAsString();
+      fields << "\n     {\"" << field_name << "\", \""
+             << yamlKey(declaration, field_name) << "\", offsetof(" << name
+             << ", " << field_name << "), Category::" << fieldCategory(field->getType(), *_context)
+             << "},";
+      ++count;
+    }
+    _reflection_file << "template <> struct Record<" << name << "> {\n"
+                     << "  static constexpr std::array<Field, " << count
+                     << "> fields{{" << fields.str() << "\n  }};\n};\n\n";
+  }
+
+  // Enum<T>::values in declaration order.
+  void writeEnumTable(const EnumDecl *declaration) {
+    if (!_reflection_file.is_open() ||
+        !declaration->isThisDeclarationADefinition()) {
+      return;
+    }
+    const std::string name = declaration->getQualifiedNameAsString();
+    size_t count = 0;
+    std::ostringstream values;
+    for (const auto *value : declaration->enumerators()) {
+      values << "\n     {\"" << value->getNameAsString() << "\", "
+             << value->getQualifiedNameAsString() << "},";
+      ++count;
+    }
+    _reflection_file << "template <> struct Enum<" << name << "> {\n"
+                     << "  static constexpr std::array<EnumValue<" << name
+                     << ">, " << count << "> values{{" << values.str()
+                     << "\n  }};\n};\n\n";
+  }
 
   std::string extractClangPostfix(const std::string &input) {
     std::string prefix = "clang_v";
@@ -144,11 +323,13 @@ private:
 
 class FindNamedClassConsumer : public ASTConsumer {
 public:
-  explicit FindNamedClassConsumer(ASTContext *context, std::string_view name)
-      : _visitor(context, name) {}
+  explicit FindNamedClassConsumer(
+      ASTContext *context, const Job &job, const YamlKeys &yaml_keys)
+      : _visitor(context, job, yaml_keys) {}
 
   void HandleTranslationUnit(ASTContext &context) override {
     _visitor.TraverseDecl(context.getTranslationUnitDecl());
+    _visitor.writeRecordTables();
   }
 
 private:
@@ -157,36 +338,273 @@ private:
 
 class FindNamedClassAction : public ASTFrontendAction {
 public:
-  explicit FindNamedClassAction(std::string_view name) : _filename(name) {}
+  explicit FindNamedClassAction(
+      const Job &job, const YamlKeys &yaml_keys,
+      std::shared_ptr<clang::DependencyCollector> dependencies)
+      : _job(job), _yaml_keys(yaml_keys),
+        _dependencies(std::move(dependencies)) {}
   std::unique_ptr<ASTConsumer>
   CreateASTConsumer(CompilerInstance &compiler, llvm::StringRef /*InFile*/) override {
+    _dependencies->attachToPreprocessor(compiler.getPreprocessor());
     return std::make_unique<FindNamedClassConsumer>(&compiler.getASTContext(),
-                                                    _filename);
+                                                    _job, _yaml_keys);
   }
 
 private:
-  std::string_view _filename;
+  const Job &_job;
+  const YamlKeys &_yaml_keys;
+  std::shared_ptr<clang::DependencyCollector> _dependencies;
 };
 
-int main(int argc, char **argv) {
-  std::vector<std::string> args;
-  std::string output_emscripten;
+namespace {
+
+// YAML keys from the IO.mapOptional("Key", Style.Field) and
+// IoMapOptional<FormatStyle>(IO, "Key", Style.Field) of Format.cpp, keyed by
+// the struct of the enclosing MappingTraits<...> and the member path. The
+// same field name is mapped by unrelated structs (Enabled, Language...). If
+// a field has many keys (deprecated aliases), the key equal to its name
+// wins.
+YamlKeys readYamlKeys(llvm::StringRef source) {
+  static const std::regex traits(
+      R"re(struct\s+MappingTraits<\s*([\w:]+)\s*>)re");
+  static const std::regex mapping(
+      R"re([mM]apOptional\w*(?:<\w+>)?\(\s*(?:IO\s*,\s*)?"(\w+)"\s*,\s*)re"
+      R"re(\w+\.((?:\w+\.)*(\w+))\s*[,)])re");
+  YamlKeys retval;
+  const std::string text = source.str();
+  // Start of each MappingTraits and the style name of its struct.
+  std::vector<std::pair<size_t, std::string>> owners;
+  for (auto it = std::sregex_iterator(text.begin(), text.end(), traits);
+       it != std::sregex_iterator(); ++it) {
+    owners.emplace_back(it->position(), styleName((*it)[1]));
+  }
+  for (auto it = std::sregex_iterator(text.begin(), text.end(), mapping);
+       it != std::sregex_iterator(); ++it) {
+    const auto owner = std::upper_bound(
+        owners.begin(), owners.end(),
+        std::make_pair(static_cast<size_t>(it->position()), std::string{}));
+    if (owner == owners.begin() || std::prev(owner)->second.empty()) {
+      continue;
+    }
+    const std::string key = (*it)[1];
+    const std::pair<std::string, std::string> field{std::prev(owner)->second,
+                                                    (*it)[2]};
+    if (key == (*it)[3] || retval.count(field) == 0) {
+      retval[field] = key;
+    }
+  }
+  return retval;
+}
+
+// Hash of the parser itself, its arguments and the content of every file
+// read by the parse. Return false if a file can't be read.
+bool hashInputs(uint64_t tool, const Job &job,
+                const std::vector<std::string> &files, uint64_t &hash) {
+  std::string key = std::to_string(tool) + '\0' + job.reflection;
+  for (const std::string &arg : job.args) {
+    key += '\0';
+    key += arg;
+  }
+  for (const std::string &file : files) {
+    const llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer =
+        llvm::MemoryBuffer::getFile(file);
+    if (!buffer) {
+      return false;
+    }
+    key += '\0';
+    key += file;
+    key += '\0';
+    key += std::to_string(llvm::xxHash64((*buffer)->getBuffer()));
+  }
+  hash = llvm::xxHash64(key);
+  return true;
+}
+
+std::string stampPath(const std::string &stamp_dir, const Job &job) {
+  return stamp_dir + "/" + llvm::sys::path::filename(job.output).str() +
+         ".stamp";
+}
+
+// The stamp holds the hash of the inputs and then the files read by the
+// previous parse, one per line.
+bool isUpToDate(uint64_t tool, const Job &job, const std::string &stamp) {
+  std::ifstream file(stamp);
+  if (!file || !llvm::sys::fs::exists(job.output) ||
+      (!job.reflection.empty() && !llvm::sys::fs::exists(job.reflection))) {
+    return false;
+  }
+  uint64_t expected = 0;
+  file >> expected;
+  std::vector<std::string> files;
+  std::string line;
+  std::getline(file, line);
+  while (std::getline(file, line)) {
+    files.push_back(line);
+  }
+  uint64_t hash = 0;
+  return !files.empty() && hashInputs(tool, job, files, hash) &&
+         hash == expected;
+}
+
+bool writeStamp(uint64_t tool, const Job &job, const std::string &stamp,
+                const clang::DependencyCollector &dependencies) {
+  std::vector<std::string> files{job.header};
+  for (const std::string &file : dependencies.getDependencies()) {
+    // The parsed code is in memory, named input.cc.
+    if (file != job.header && file != "input.cc") {
+      files.push_back(file);
+    }
+  }
+  if (!job.yaml.empty()) {
+    files.push_back(job.yaml);
+  }
+  uint64_t hash = 0;
+  if (!hashInputs(tool, job, files, hash)) {
+    return false;
+  }
+  std::ofstream file(stamp);
+  file << hash << "\n";
+  for (const std::string &dependency : files) {
+    file << dependency << "\n";
+  }
+  return static_cast<bool>(file);
+}
+
+bool runJob(uint64_t tool, const Job &job, const std::string &stamp_dir) {
+  const std::string stamp =
+      stamp_dir.empty() ? std::string{} : stampPath(stamp_dir, job);
+  if (!stamp.empty()) {
+    if (isUpToDate(tool, job, stamp)) {
+      return true;
+    }
+    llvm::sys::fs::remove(stamp);
+  }
+
+  const llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> header =
+      llvm::MemoryBuffer::getFileOrSTDIN(job.header);
+  if (!header) {
+    return false;
+  }
+  YamlKeys yaml_keys;
+  if (!job.yaml.empty()) {
+    const llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> yaml =
+        llvm::MemoryBuffer::getFile(job.yaml);
+    if (!yaml) {
+      return false;
+    }
+    yaml_keys = readYamlKeys((*yaml)->getBuffer());
+  }
+  auto dependencies = std::make_shared<clang::DependencyCollector>();
+  if (!clang::tooling::runToolOnCodeWithArgs(
+          std::make_unique<FindNamedClassAction>(job, yaml_keys,
+                                                 dependencies),
+          (*header)->getBuffer(), job.args)) {
+    return false;
+  }
+  return stamp.empty() || writeStamp(tool, job, stamp, *dependencies);
+}
 
-  args.emplace_back("-std=c++17");
+void usage(const char *name) {
+  std::cerr << "Usage: " << name
+            << " [-j threads] [--stamp-dir dir] [-I dir]... "
+               "(header [-I dir]... -OCPP output [-OREFLECT output "
+               "[-YAML Format.cpp]])...\n"
+            << "Generate the embind bindings of each header in parallel.\n"
+            << "-OREFLECT also generates the constexpr tables of "
+               "clang_vx::reflection. The YAML keys of the fields are read "
+               "from -YAML.\n"
+            << "-I before the first header is used by every header.\n"
+            << "With --stamp-dir, an output is only generated again if the "
+               "parser or a file read by the previous parse changed.\n";
+}
+
+// Address used to find the path of the executable.
+int anchor;
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::vector<std::string> common_args{"-std=c++17"};
+  std::vector<std::string> args = common_args;
+  std::vector<Job> jobs;
+  size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  std::string stamp_dir;
 
-  for (int i = 2; i < argc; i++) {
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 == argc && argv[i][0] == '-') {
+      usage(argv[0]);
+      return 1;
+    }
     if (strcmp(argv[i], "-I") == 0) {
-      args.emplace_back("-I");
-      args.emplace_back(argv[i + 1]);
+      std::vector<std::string> &job_args =
+          jobs.empty() ? args : jobs.back().args;
+      job_args.emplace_back("-I");
+      job_args.emplace_back(argv[++i]);
+    } else if (strcmp(argv[i], "-OCPP") == 0) {
+      if (jobs.empty()) {
+        usage(argv[0]);
+        return 1;
+      }
+      jobs.back().output = argv[++i];
+    } else if (strcmp(argv[i], "-OREFLECT") == 0 ||
+               strcmp(argv[i], "-YAML") == 0) {
+      if (jobs.empty()) {
+        usage(argv[0]);
+        return 1;
+      }
+      (argv[i][1] == 'O' ? jobs.back().reflection : jobs.back().yaml) =
+          argv[i + 1];
+      i++;
+    } else if (strcmp(argv[i], "-j") == 0) {
+      threads = std::max<size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--stamp-dir") == 0) {
+      stamp_dir = argv[++i];
+    } else {
+      jobs.push_back({argv[i], args, {}, {}, {}});
     }
-    if (strcmp(argv[i], "-OCPP") == 0) {
-      output_emscripten = argv[i + 1];
+  }
+
+  if (jobs.empty() ||
+      std::any_of(jobs.begin(), jobs.end(),
+                  [](const Job &job) { return job.output.empty(); })) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  uint64_t tool = 0;
+  if (!stamp_dir.empty()) {
+    const llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> executable =
+        llvm::MemoryBuffer::getFile(
+            llvm::sys::fs::getMainExecutable(argv[0], &anchor));
+    if (!executable || llvm::sys::fs::create_directories(stamp_dir)) {
+      std::cerr << "Failed to prepare " << stamp_dir << ".\n";
+      return 1;
     }
+    tool = llvm::xxHash64((*executable)->getBuffer());
   }
 
-  if (argc > 1) {
-    clang::tooling::runToolOnCodeWithArgs(
-        std::make_unique<FindNamedClassAction>(output_emscripten),
-        llvm::MemoryBuffer::getFileOrSTDIN(argv[1]).get()->getBuffer(), args);
+  std::atomic<size_t> next{0};
+  std::atomic<bool> success{true};
+  std::mutex errors;
+  const auto worker = [&]() {
+    for (size_t i = next++; i < jobs.size(); i = next++) {
+      if (!runJob(tool, jobs[i], stamp_dir)) {
+        success = false;
+        const std::lock_guard<std::mutex> lock(errors);
+        std::cerr << "Failed to generate " << jobs[i].output << " from "
+                  << jobs[i].header << ".\n";
+      }
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (size_t i = 1; i < std::min(threads, jobs.size()); i++) {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : pool) {
+    thread.join();
   }
+
+  return success ? 0 : 1;
 }
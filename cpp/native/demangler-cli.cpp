@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "demangler-elf.h"
+#include "demangler-json.h"
+#include "demangler.h"
+#include "mapped-file.h"
+#include "parallel-chunks.h"
+
+namespace {
+
+constexpr size_t chunk_size = 4 * 1024 * 1024;
+
+void usage(const char *name) {
+  std::cerr << "Usage: " << name << " [-j threads] [--elf | --json] [file]\n"
+            << "Demangle every symbol of file (or stdin) like c++filt.\n"
+            << "With --elf, file is an ELF object or archive and its symbol "
+               "tables are demangled.\n"
+            << "With --json, every line is a symbol and is written as a JSON "
+               "object on its own line.\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string path = "-";
+  size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  bool elf = false;
+  bool json = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = std::strtoul(argv[i + 1], nullptr, 10);
+      i++;
+    } else if (strcmp(argv[i], "--elf") == 0) {
+      elf = true;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      json = true;
+    } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+      usage(argv[0]);
+      return 0;
+    } else {
+      path = argv[i];
+    }
+  }
+
+  const auto write = [](const std::string &output) {
+    if (std::fwrite(output.data(), 1, output.size(), stdout) !=
+        output.size()) {
+      throw std::runtime_error("Failed to write output.");
+    }
+  };
+
+  try {
+    const web_utils::MappedFile file(path);
+
+    if (elf) {
+      web_demangler::demangleElfTo(file.view(), write);
+      return std::fflush(stdout) == 0 ? 0 : 1;
+    }
+
+    const std::vector<std::string_view> chunks =
+        web_utils::splitChunks(file.view(), chunk_size, "\n");
+
+    web_utils::processChunksInOrder(
+        chunks, threads,
+        [json](std::string_view chunk, std::string &output) {
+          output.reserve(chunk.size() + chunk.size() / 2);
+          if (!json) {
+            web_demangler::demangleWordsTo(chunk, output);
+            return;
+          }
+          web_demangler::forEachLine(chunk, [&output](std::string_view line) {
+            web_demangler::demangleJsonTo(line, output);
+            output += '\n';
+          });
+        },
+        write);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+
+  return std::fflush(stdout) == 0 ? 0 : 1;
+}
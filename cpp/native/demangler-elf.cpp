@@ -0,0 +1,296 @@
+#include "demangler-elf.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/BinaryFormat/ELF.h>
+#include <llvm/Object/ELF.h>
+#include <llvm/Object/ELFTypes.h>
+#include <llvm/Support/Error.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "demangler.h"
+
+namespace web_demangler {
+
+namespace {
+
+// Symbols written between two calls of write.
+constexpr size_t flush_symbols = 4096;
+
+constexpr std::string_view elf_magic = "\177ELF";
+constexpr std::string_view archive_magic = "!<arch>\n";
+constexpr size_t archive_header_size = 60;
+
+// Buffer of the lines given to write.
+class Output {
+public:
+  explicit Output(const std::function<void(const std::string &)> &write)
+      : _write(write) {}
+
+  std::string &text() { return _text; }
+
+  void endSymbol() {
+    if (++_symbols == flush_symbols) {
+      flush();
+    }
+  }
+
+  void flush() {
+    if (!_text.empty()) {
+      _write(_text);
+      _text.clear();
+    }
+    _symbols = 0;
+  }
+
+private:
+  const std::function<void(const std::string &)> &_write;
+  std::string _text;
+  size_t _symbols = 0;
+};
+
+void appendHex(uint64_t value, std::string &output) {
+  constexpr std::string_view digits = "0123456789abcdef";
+  std::array<char, 16> buffer{};
+  for (size_t i = buffer.size(); i > 0; i--) {
+    buffer[i - 1] = digits[value & 0xFU];
+    value >>= 4U;
+  }
+  output.append(buffer.data(), buffer.size());
+}
+
+template <typename T> T unwrap(llvm::Expected<T> value) {
+  if (!value) {
+    throw std::runtime_error("Failed to read ELF object.\n" +
+                             llvm::toString(value.takeError()));
+  }
+  return std::move(*value);
+}
+
+template <class ELFT>
+void appendSymbols(const llvm::object::ELFFile<ELFT> &elf,
+                   typename ELFT::ShdrRange sections,
+                   const typename ELFT::Shdr &table,
+                   const std::vector<llvm::StringRef> &section_names,
+                   Output &output) {
+  const typename ELFT::SymRange symbols = unwrap(elf.symbols(&table));
+  const llvm::StringRef names =
+      unwrap(elf.getStringTableForSymtab(table, sections));
+  // Section indexes that don't fit in st_shndx (SHN_XINDEX).
+  llvm::ArrayRef<typename ELFT::Word> shndx_table;
+  for (const typename ELFT::Shdr &section : sections) {
+    if (section.sh_type == llvm::ELF::SHT_SYMTAB_SHNDX &&
+        section.sh_link == static_cast<uint32_t>(&table - sections.begin())) {
+      shndx_table = unwrap(elf.getSHNDXTable(section, sections));
+    }
+  }
+
+  const bool relocatable = elf.getHeader().e_type == llvm::ELF::ET_REL;
+  std::string &text = output.text();
+  for (const typename ELFT::Sym &symbol : symbols) {
+    llvm::Expected<llvm::StringRef> name = symbol.getName(names);
+    if (!name) {
+      llvm::consumeError(name.takeError());
+      continue;
+    }
+    // The null symbol and the section symbols have no name.
+    if (name->empty()) {
+      continue;
+    }
+
+    std::string_view section_name = "*UND*";
+    uint64_t address = symbol.st_value;
+    if (symbol.isAbsolute()) {
+      section_name = "*ABS*";
+    } else if (symbol.isCommon()) {
+      section_name = "*COM*";
+    } else if (!symbol.isUndefined()) {
+      llvm::Expected<uint32_t> index = elf.getSectionIndex(
+          symbol, symbols,
+          llvm::object::DataRegion<typename ELFT::Word>(shndx_table));
+      if (!index) {
+        llvm::consumeError(index.takeError());
+      } else if (*index < section_names.size()) {
+        section_name = {section_names[*index].data(),
+                        section_names[*index].size()};
+        // Like llvm::object::ELFObjectFile::getSymbolAddress.
+        if (relocatable) {
+          address += sections[*index].sh_addr;
+        }
+      }
+    }
+
+    appendHex(address, text);
+    text += '\t';
+    appendHex(symbol.st_size, text);
+    text += '\t';
+    text += section_name;
+    text += '\t';
+    demangleSymbolTo({name->data(), name->size()}, text);
+    text += '\n';
+    output.endSymbol();
+  }
+}
+
+template <class ELFT> void appendObject(llvm::StringRef data, Output &output) {
+  const llvm::object::ELFFile<ELFT> elf =
+      unwrap(llvm::object::ELFFile<ELFT>::create(data));
+  const typename ELFT::ShdrRange sections = unwrap(elf.sections());
+  const llvm::StringRef section_strings =
+      unwrap(elf.getSectionStringTable(sections));
+
+  std::vector<llvm::StringRef> section_names;
+  section_names.reserve(sections.size());
+  for (const typename ELFT::Shdr &section : sections) {
+    llvm::Expected<llvm::StringRef> name =
+        elf.getSectionName(section, section_strings);
+    if (name) {
+      section_names.push_back(*name);
+    } else {
+      llvm::consumeError(name.takeError());
+      section_names.emplace_back();
+    }
+  }
+
+  for (const unsigned type : {llvm::ELF::SHT_SYMTAB, llvm::ELF::SHT_DYNSYM}) {
+    for (const typename ELFT::Shdr &section : sections) {
+      if (section.sh_type == type) {
+        appendSymbols(elf, sections, section, section_names, output);
+      }
+    }
+  }
+  output.flush();
+}
+
+void appendElf(std::string_view data, Output &output) {
+  // The ELF structures are read in place. Archive members are only 2-byte
+  // aligned.
+  std::vector<uint64_t> aligned;
+  if (reinterpret_cast<uintptr_t>(data.data()) % alignof(uint64_t) != 0) {
+    aligned.resize((data.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    data.copy(reinterpret_cast<char *>(aligned.data()), data.size());
+    data = {reinterpret_cast<const char *>(aligned.data()), data.size()};
+  }
+
+  const llvm::StringRef object(data.data(), data.size());
+  const auto [elf_class, elf_data] = llvm::object::getElfArchType(object);
+  const bool little_endian = elf_data == llvm::ELF::ELFDATA2LSB;
+  if (elf_class == llvm::ELF::ELFCLASS32 && little_endian) {
+    appendObject<llvm::object::ELF32LE>(object, output);
+  } else if (elf_class == llvm::ELF::ELFCLASS32) {
+    appendObject<llvm::object::ELF32BE>(object, output);
+  } else if (little_endian) {
+    appendObject<llvm::object::ELF64LE>(object, output);
+  } else {
+    appendObject<llvm::object::ELF64BE>(object, output);
+  }
+}
+
+size_t parseDecimal(std::string_view field) {
+  while (!field.empty() && field.back() == ' ') {
+    field.remove_suffix(1);
+  }
+  size_t retval = 0;
+  const auto [end, error] =
+      std::from_chars(field.data(), field.data() + field.size(), retval);
+  if (error != std::errc() || end != field.data() + field.size()) {
+    throw std::runtime_error("Failed to read archive.");
+  }
+  return retval;
+}
+
+// Members of a GNU or BSD ar archive. llvm::object::Archive is not used: it
+// links the IR and bitcode readers of llvm::object::createBinary.
+void appendArchive(std::string_view data, Output &output) {
+  data.remove_prefix(archive_magic.size());
+  std::string_view long_names;
+  while (data.size() >= archive_header_size) {
+    const std::string_view header = data.substr(0, archive_header_size);
+    if (header.substr(58, 2) != "`\n") {
+      throw std::runtime_error("Failed to read archive.");
+    }
+    const size_t size = parseDecimal(header.substr(48, 10));
+    if (size > data.size() - archive_header_size) {
+      throw std::runtime_error("Failed to read archive.");
+    }
+    std::string_view member = data.substr(archive_header_size, size);
+    // Members are 2-byte aligned.
+    data.remove_prefix(
+        std::min(data.size(), archive_header_size + size + size % 2));
+
+    std::string_view name = header.substr(0, 16);
+    name = name.substr(0, name.find_last_not_of(' ') + 1);
+    if (name == "//") {
+      long_names = member;
+      continue;
+    }
+    if (name == "/" || name == "/SYM64/" || name.rfind("__.SYMDEF", 0) == 0) {
+      continue;
+    }
+    if (name.rfind("#1/", 0) == 0) {
+      // BSD: the name is at the start of the data.
+      const size_t length = parseDecimal(name.substr(3));
+      if (length > member.size()) {
+        throw std::runtime_error("Failed to read archive.");
+      }
+      name = member.substr(0, length);
+      name = name.substr(0, name.find('\0'));
+      member.remove_prefix(length);
+    } else if (name.size() > 1 && name.front() == '/') {
+      // GNU: offset of the name in the "//" member, ended by "/\n".
+      const size_t offset = parseDecimal(name.substr(1));
+      if (offset >= long_names.size()) {
+        throw std::runtime_error("Failed to read archive.");
+      }
+      name = long_names.substr(offset);
+      name = name.substr(0, name.find("/\n"));
+    } else if (!name.empty() && name.back() == '/') {
+      name.remove_suffix(1);
+    }
+
+    if (member.substr(0, elf_magic.size()) != elf_magic) {
+      continue;
+    }
+    std::string &text = output.text();
+    text += '\n';
+    text += name;
+    text += ":\n";
+    appendElf(member, output);
+  }
+}
+
+} // namespace
+
+void demangleElfTo(std::string_view data,
+                   const std::function<void(const std::string &)> &write) {
+  Output output(write);
+  if (data.substr(0, elf_magic.size()) == elf_magic) {
+    appendElf(data, output);
+  } else if (data.substr(0, archive_magic.size()) == archive_magic) {
+    appendArchive(data, output);
+  } else {
+    throw std::runtime_error("Only ELF objects and archives are supported.");
+  }
+  output.flush();
+}
+
+std::string demangleElf(const std::string &data) {
+  std::string retval;
+  demangleElfTo(data, [&retval](const std::string &output) {
+    retval += output;
+  });
+  return retval;
+}
+
+} // namespace web_demangler
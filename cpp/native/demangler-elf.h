@@ -0,0 +1,19 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace web_demangler {
+
+// Write one line "address\tsize\tsection\tdemangled name" per symbol of the
+// .symtab and .dynsym tables of an ELF object or of every ELF member of an
+// archive. write is called after each object and every few thousand symbols,
+// so the output is never held whole in memory. Throws std::runtime_error if
+// data is not an object or an archive.
+void demangleElfTo(std::string_view data,
+                   const std::function<void(const std::string &)> &write);
+
+std::string demangleElf(const std::string &data);
+
+} // namespace web_demangler
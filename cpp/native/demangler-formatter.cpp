@@ -0,0 +1,151 @@
+#include "demangler-formatter.h"
+
+#include <algorithm>
+#include <clang/Format/Format.h>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "demangler.h"
+#include "formatter.h"
+
+namespace web_demangler {
+
+namespace {
+
+// Every demangled name is turned into a statement followed by this comment so
+// that all names can be formatted at once in a single translation unit.
+constexpr std::string_view separator = "// web-demangler-separator";
+
+constexpr std::string_view whitespaces = " \t\r\n";
+
+std::string_view trim(std::string_view str) {
+  const size_t start = str.find_first_not_of(whitespaces);
+  if (start == std::string_view::npos) {
+    return {};
+  }
+  const size_t end = str.find_last_not_of(whitespaces);
+  return str.substr(start, end - start + 1);
+}
+
+std::vector<std::string_view> splitLines(std::string_view text) {
+  std::vector<std::string_view> retval;
+  size_t start = 0;
+  while (true) {
+    const size_t end = text.find('\n', start);
+    if (end == std::string_view::npos) {
+      retval.push_back(text.substr(start));
+      return retval;
+    }
+    retval.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+}
+
+// Split the formatted translation unit back into one block per demangled name.
+// Returns an empty vector if the separators have not been kept as is.
+std::vector<std::string_view> splitFormatted(std::string_view formatted,
+                                             size_t count) {
+  std::vector<std::string_view> retval;
+  retval.reserve(count);
+  size_t block_start = 0;
+  size_t line_start = 0;
+  while (line_start < formatted.size()) {
+    size_t line_end = formatted.find('\n', line_start);
+    if (line_end == std::string_view::npos) {
+      line_end = formatted.size();
+    }
+    const std::string_view line =
+        formatted.substr(line_start, line_end - line_start);
+    if (line.find("//") != std::string_view::npos) {
+      if (trim(line) != separator) {
+        return {};
+      }
+      std::string_view block =
+          trim(formatted.substr(block_start, line_start - block_start));
+      // Remove the semicolon added to end the statement.
+      if (block.empty() || block.back() != ';') {
+        return {};
+      }
+      block.remove_suffix(1);
+      retval.push_back(trim(block));
+      block_start = line_end + 1;
+    }
+    line_start = line_end + 1;
+  }
+  if (retval.size() != count ||
+      !trim(formatted.substr(std::min(block_start, formatted.size())))
+           .empty()) {
+    return {};
+  }
+  return retval;
+}
+
+// The names share one translation unit in the batched pass: alignment would
+// line up unrelated names across the separators (AcrossComments) and change
+// the output. A single name has nothing to align with, so it is turned off.
+clang::format::FormatStyle
+batchStyle(const clang::format::FormatStyle &format_style) {
+  clang::format::FormatStyle retval = format_style;
+  retval.AlignConsecutiveAssignments.Enabled = false;
+  retval.AlignConsecutiveBitFields.Enabled = false;
+  retval.AlignConsecutiveDeclarations.Enabled = false;
+  retval.AlignConsecutiveMacros.Enabled = false;
+  retval.AlignConsecutiveShortCaseStatements.Enabled = false;
+  return retval;
+}
+
+} // namespace
+
+std::string demangleAndFormat(const std::string &mangled_names,
+                              const clang::format::FormatStyle &format_style) {
+  const std::vector<std::string_view> lines = splitLines(mangled_names);
+
+  std::string code;
+  code.reserve(mangled_names.size() * 2);
+  std::vector<size_t> demangled_offsets;
+  demangled_offsets.reserve(lines.size() + 1);
+  for (const std::string_view line : lines) {
+    demangled_offsets.push_back(code.size());
+    demangleTo(trim(line), code);
+    code += ";\n";
+    code += separator;
+    code += '\n';
+  }
+  demangled_offsets.push_back(code.size());
+
+  const std::string formatted =
+      web_formatter::format(code, batchStyle(format_style));
+
+  std::string retval;
+  retval.reserve(formatted.size());
+  const std::vector<std::string_view> blocks =
+      splitFormatted(formatted, lines.size());
+  if (!blocks.empty()) {
+    for (size_t i = 0; i < blocks.size(); i++) {
+      if (i != 0) {
+        retval += '\n';
+      }
+      retval += blocks[i];
+    }
+    return retval;
+  }
+
+  // Fallback if a demangled name breaks the translation unit (unbalanced
+  // brackets, ...): format each name on its own.
+  const std::string_view code_view = code;
+  const size_t suffix_size = separator.size() + 3;
+  for (size_t i = 0; i + 1 < demangled_offsets.size(); i++) {
+    if (i != 0) {
+      retval += '\n';
+    }
+    const std::string demangled{code_view.substr(
+        demangled_offsets[i],
+        demangled_offsets[i + 1] - demangled_offsets[i] - suffix_size)};
+    retval += web_formatter::format(demangled, format_style);
+  }
+  return retval;
+}
+
+} // namespace web_demangler
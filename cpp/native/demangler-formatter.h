@@ -0,0 +1,15 @@
+#pragma once
+
+#include <clang/Format/Format.h>
+#include <string>
+
+namespace web_demangler {
+
+// Demangle every line of mangled_names and format it with format_style. All
+// names are formatted in one clang-format pass, so the AlignConsecutive*
+// options are ignored. If a name breaks that pass, each name is formatted on
+// its own.
+std::string demangleAndFormat(const std::string &mangled_names,
+                              const clang::format::FormatStyle &format_style);
+
+} // namespace web_demangler
@@ -0,0 +1,339 @@
+#include "demangler-json.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <llvm/Demangle/ItaniumDemangle.h>
+#include <llvm/Demangle/Utility.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "demangler.h"
+
+namespace web_demangler {
+
+namespace {
+
+using llvm::itanium_demangle::Node;
+
+// Nodes only live during the parsing of one symbol. Blocks are kept between
+// symbols to avoid allocations when demangling in batch.
+class BumpAllocator {
+public:
+  void reset() {
+    _block = 0;
+    _used = 0;
+  }
+
+  void *allocate(size_t size) {
+    size = (size + alignof(std::max_align_t) - 1) &
+           ~(alignof(std::max_align_t) - 1);
+    if (_block < _blocks.size() && _used + size <= _blocks[_block].second) {
+      void *retval = _blocks[_block].first.get() + _used;
+      _used += size;
+      return retval;
+    }
+    // Find the next block big enough.
+    while (_block + 1 < _blocks.size()) {
+      _block++;
+      if (size <= _blocks[_block].second) {
+        _used = size;
+        return _blocks[_block].first.get();
+      }
+    }
+    const size_t block_size = std::max<size_t>(size, 4096);
+    _blocks.emplace_back(std::make_unique<char[]>(block_size), block_size);
+    _block = _blocks.size() - 1;
+    _used = size;
+    return _blocks[_block].first.get();
+  }
+
+  template <typename T, typename... Args> T *makeNode(Args &&...args) {
+    return new (allocate(sizeof(T))) T(std::forward<Args>(args)...);
+  }
+
+  void *allocateNodeArray(size_t size) {
+    return allocate(size * sizeof(Node *));
+  }
+
+private:
+  std::vector<std::pair<std::unique_ptr<char[]>, size_t>> _blocks;
+  size_t _block = 0;
+  size_t _used = 0;
+};
+
+using Parser = llvm::itanium_demangle::ManglingParser<BumpAllocator>;
+
+// Print nodes in one reused buffer.
+class NodePrinter {
+public:
+  NodePrinter() = default;
+  NodePrinter(const NodePrinter &) = delete;
+  NodePrinter(NodePrinter &&) = delete;
+  NodePrinter &operator=(const NodePrinter &) = delete;
+  NodePrinter &operator=(NodePrinter &&) = delete;
+  ~NodePrinter() { std::free(_buffer.getBuffer()); }
+
+  std::string_view print(const Node *node) {
+    _buffer.setCurrentPosition(0);
+    node->print(_buffer);
+    return {_buffer.getBuffer(), _buffer.getCurrentPosition()};
+  }
+
+private:
+  llvm::itanium_demangle::OutputBuffer _buffer;
+};
+
+struct StructuredName {
+  std::vector<std::string> scope;
+  std::string name;
+  std::vector<std::string> template_args;
+};
+
+void flattenScope(const Node *node, NodePrinter &printer,
+                  std::vector<std::string> &scope) {
+  switch (node->getKind()) {
+  case Node::KNestedName: {
+    const auto *nested =
+        static_cast<const llvm::itanium_demangle::NestedName *>(node);
+    flattenScope(nested->Qual, printer, scope);
+    scope.emplace_back(printer.print(nested->Name));
+    break;
+  }
+  case Node::KStdQualifiedName: {
+    const auto *std_name =
+        static_cast<const llvm::itanium_demangle::StdQualifiedName *>(node);
+    scope.emplace_back("std");
+    scope.emplace_back(printer.print(std_name->Child));
+    break;
+  }
+  default:
+    scope.emplace_back(printer.print(node));
+    break;
+  }
+}
+
+void flattenName(const Node *node, NodePrinter &printer,
+                 StructuredName &retval) {
+  switch (node->getKind()) {
+  case Node::KNestedName: {
+    const auto *nested =
+        static_cast<const llvm::itanium_demangle::NestedName *>(node);
+    flattenScope(nested->Qual, printer, retval.scope);
+    flattenName(nested->Name, printer, retval);
+    break;
+  }
+  case Node::KStdQualifiedName: {
+    const auto *std_name =
+        static_cast<const llvm::itanium_demangle::StdQualifiedName *>(node);
+    retval.scope.emplace_back("std");
+    flattenName(std_name->Child, printer, retval);
+    break;
+  }
+  case Node::KLocalName: {
+    const auto *local =
+        static_cast<const llvm::itanium_demangle::LocalName *>(node);
+    retval.scope.emplace_back(printer.print(local->Encoding));
+    flattenName(local->Entity, printer, retval);
+    break;
+  }
+  case Node::KNameWithTemplateArgs: {
+    const auto *templated =
+        static_cast<const llvm::itanium_demangle::NameWithTemplateArgs *>(
+            node);
+    flattenName(templated->Name, printer, retval);
+    if (templated->TemplateArgs->getKind() == Node::KTemplateArgs) {
+      const auto *args = static_cast<const llvm::itanium_demangle::TemplateArgs *>(
+          templated->TemplateArgs);
+      args->match([&](llvm::itanium_demangle::NodeArray params) {
+        for (const Node *arg : params) {
+          retval.template_args.emplace_back(printer.print(arg));
+        }
+      });
+    }
+    break;
+  }
+  default:
+    retval.name = printer.print(node);
+    break;
+  }
+}
+
+void appendJsonString(std::string_view str, std::string &output) {
+  output += '"';
+  for (const char c : str) {
+    switch (c) {
+    case '"':
+      output += "\\\"";
+      break;
+    case '\\':
+      output += "\\\\";
+      break;
+    case '\n':
+      output += "\\n";
+      break;
+    case '\r':
+      output += "\\r";
+      break;
+    case '\t':
+      output += "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        std::array<char, 7> escaped{};
+        std::snprintf(escaped.data(), escaped.size(), "\\u%04x",
+                      static_cast<unsigned int>(c));
+        output += escaped.data();
+      } else {
+        output += c;
+      }
+      break;
+    }
+  }
+  output += '"';
+}
+
+void appendJsonArray(const std::vector<std::string> &array,
+                     std::string &output) {
+  output += '[';
+  for (size_t i = 0; i < array.size(); i++) {
+    if (i != 0) {
+      output += ',';
+    }
+    appendJsonString(array[i], output);
+  }
+  output += ']';
+}
+
+void appendStructuredName(const StructuredName &name, std::string &output) {
+  output += ",\"scope\":";
+  appendJsonArray(name.scope, output);
+  output += ",\"name\":";
+  appendJsonString(name.name, output);
+  output += ",\"template_args\":";
+  appendJsonArray(name.template_args, output);
+}
+
+// Thread local to keep allocations between calls in batch mode.
+struct Context {
+  Parser parser{nullptr, nullptr};
+  NodePrinter printer;
+  std::string mangled_name_z;
+  std::string demangled;
+};
+
+Context &context() {
+  thread_local Context retval;
+  return retval;
+}
+
+} // namespace
+
+void demangleJsonTo(std::string_view mangled_name, std::string &output) {
+  Context &ctx = context();
+
+  Parser &parser = ctx.parser;
+  parser.reset(mangled_name.data(), mangled_name.data() + mangled_name.size());
+  const Node *ast = parser.parse();
+  if (ast == nullptr) {
+    // Make a second try by prefixing with _Z for Itanium.
+    ctx.mangled_name_z = "_Z";
+    ctx.mangled_name_z += mangled_name;
+    parser.reset(ctx.mangled_name_z.data(),
+                 ctx.mangled_name_z.data() + ctx.mangled_name_z.size());
+    ast = parser.parse();
+  }
+
+  output += "{\"mangled\":";
+  appendJsonString(mangled_name, output);
+  output += ",\"demangled\":";
+  if (ast == nullptr) {
+    ctx.demangled.clear();
+    demangleTo(mangled_name, ctx.demangled);
+    appendJsonString(ctx.demangled, output);
+    output += ",\"kind\":\"unknown\"}";
+    return;
+  }
+  appendJsonString(ctx.printer.print(ast), output);
+
+  switch (ast->getKind()) {
+  case Node::KFunctionEncoding: {
+    const auto *function =
+        static_cast<const llvm::itanium_demangle::FunctionEncoding *>(ast);
+    output += ",\"kind\":\"function\"";
+    StructuredName name;
+    flattenName(function->getName(), ctx.printer, name);
+    appendStructuredName(name, output);
+    std::vector<std::string> params;
+    for (const Node *param : function->getParams()) {
+      params.emplace_back(ctx.printer.print(param));
+    }
+    output += ",\"params\":";
+    appendJsonArray(params, output);
+    output += ",\"return_type\":";
+    appendJsonString(function->getReturnType() != nullptr
+                         ? ctx.printer.print(function->getReturnType())
+                         : std::string_view{},
+                     output);
+    std::vector<std::string> qualifiers;
+    const llvm::itanium_demangle::Qualifiers cv = function->getCVQuals();
+    if ((cv & llvm::itanium_demangle::QualConst) != 0) {
+      qualifiers.emplace_back("const");
+    }
+    if ((cv & llvm::itanium_demangle::QualVolatile) != 0) {
+      qualifiers.emplace_back("volatile");
+    }
+    if ((cv & llvm::itanium_demangle::QualRestrict) != 0) {
+      qualifiers.emplace_back("restrict");
+    }
+    output += ",\"qualifiers\":";
+    appendJsonArray(qualifiers, output);
+    output += ",\"ref_qualifier\":";
+    switch (function->getRefQual()) {
+    case llvm::itanium_demangle::FrefQualLValue:
+      output += "\"&\"";
+      break;
+    case llvm::itanium_demangle::FrefQualRValue:
+      output += "\"&&\"";
+      break;
+    default:
+      output += "\"\"";
+      break;
+    }
+    break;
+  }
+  case Node::KSpecialName:
+  case Node::KCtorVtableSpecialName:
+    output += ",\"kind\":\"special\"";
+    break;
+  default: {
+    output += ",\"kind\":\"data\"";
+    StructuredName name;
+    flattenName(ast, ctx.printer, name);
+    appendStructuredName(name, output);
+    break;
+  }
+  }
+  output += '}';
+}
+
+std::string demangleJson(const std::string &mangled_names) {
+  std::string retval = "[";
+  bool first = true;
+  forEachLine(mangled_names, [&retval, &first](std::string_view line) {
+    if (!first) {
+      retval += ',';
+    }
+    first = false;
+    demangleJsonTo(line, retval);
+  });
+  retval += ']';
+  return retval;
+}
+
+} // namespace web_demangler
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace web_demangler {
+
+// Call fn(line) on every line of text without the spaces, tabs and '\r' around
+// it. A newline at the end of text doesn't start an empty line. Shared by the
+// wasm and the command line JSON output so both see the same symbols.
+template <typename F> void forEachLine(std::string_view text, F fn) {
+  constexpr std::string_view blanks = " \t\r";
+  while (!text.empty()) {
+    const size_t end = std::min(text.find('\n'), text.size());
+    std::string_view line = text.substr(0, end);
+    const size_t first = line.find_first_not_of(blanks);
+    line = first == std::string_view::npos
+               ? std::string_view{}
+               : line.substr(first, line.find_last_not_of(blanks) - first + 1);
+    fn(line);
+    text.remove_prefix(std::min(end + 1, text.size()));
+  }
+}
+
+// Append a JSON object describing mangled_name to output:
+// {"mangled", "demangled", "kind", "scope", "name", "template_args",
+//  "params", "return_type", "qualifiers", "ref_qualifier"}.
+// kind is "function", "data", "special" or "unknown". Only "function" and
+// "data" have the structured fields. Only Itanium symbols are structured.
+void demangleJsonTo(std::string_view mangled_name, std::string &output);
+
+// Return a JSON array with one object per line of mangled_names, split by
+// forEachLine.
+std::string demangleJson(const std::string &mangled_names);
+
+} // namespace web_demangler
@@ -1,21 +1,63 @@
 #include "demangler.h"
 
+#include <cstddef>
 #include <llvm/Demangle/Demangle.h>
 #include <string>
+#include <string_view>
 
 namespace web_demangler {
 
 std::string demangle(const std::string &mangled_name) {
+  std::string retval;
+  demangleTo(mangled_name, retval);
+  return retval;
+}
+
+void demangleTo(std::string_view mangled_name, std::string &output) {
   std::string retval = llvm::demangle(mangled_name);
   if (retval == mangled_name) {
     // Make a second try by prefixing with _Z for Itanium.
-    const std::string mangled_name_z = "_Z" + mangled_name;
+    std::string mangled_name_z = "_Z";
+    mangled_name_z += mangled_name;
     const std::string retval_z = llvm::demangle(mangled_name_z);
     if (retval_z != mangled_name_z) {
-      return retval_z;
+      output += retval_z;
+      return;
     }
   }
-  return retval;
+  output += retval;
+}
+
+void demangleSymbolTo(std::string_view symbol, std::string &output) {
+  // Itanium, Rust and D symbols start with _ (or ._), Microsoft with ?.
+  // Skip the call to llvm for all other symbols.
+  if (!symbol.empty() &&
+      (symbol[0] == '_' || symbol[0] == '?' ||
+       (symbol[0] == '.' && symbol.size() > 1 && symbol[1] == '_'))) {
+    output += llvm::demangle(symbol);
+  } else {
+    output += symbol;
+  }
+}
+
+void demangleWordsTo(std::string_view text, std::string &output) {
+  constexpr std::string_view whitespaces = " \t\n\v\f\r";
+
+  size_t pos = 0;
+  while (pos < text.size()) {
+    const size_t word_start = text.find_first_not_of(whitespaces, pos);
+    if (word_start == std::string_view::npos) {
+      output += text.substr(pos);
+      return;
+    }
+    output += text.substr(pos, word_start - pos);
+    size_t word_end = text.find_first_of(whitespaces, word_start);
+    if (word_end == std::string_view::npos) {
+      word_end = text.size();
+    }
+    demangleSymbolTo(text.substr(word_start, word_end - word_start), output);
+    pos = word_end;
+  }
 }
 
 } // namespace web_demangler
@@ -1,9 +1,21 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace web_demangler {
 
 std::string demangle(const std::string &mangled_name);
 
+// Append the demangled name to output.
+void demangleTo(std::string_view mangled_name, std::string &output);
+
+// Append the demangled symbol to output. Unlike demangleTo, there is no
+// second try with _Z prefix.
+void demangleSymbolTo(std::string_view symbol, std::string &output);
+
+// Demangle every whitespace separated word of text like c++filt and append the
+// result to output. Separators are kept as is.
+void demangleWordsTo(std::string_view text, std::string &output);
+
 } // namespace web_demangler
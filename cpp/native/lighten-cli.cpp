@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "lighten-csv.h"
+#include "lighten-json.h"
+#include "lighten-parallel.h"
+#include "mapped-file.h"
+
+namespace {
+
+constexpr size_t chunk_size = 1024 * 1024;
+constexpr size_t parallel_chunk_size = 4 * 1024 * 1024;
+
+void usage(const char *name) {
+  std::cerr << "Usage: " << name
+            << " [-j threads] [-s size] [--json | (--csv | --tsv) "
+               "[-c column[:size]]...] [file]\n"
+            << "Lighten the numbers of file (or stdin).\n"
+            << "-s is the size (4) of number.\n"
+            << "By default, every number of the text is lighten in parallel. "
+               "Numbers in words like x1.5 are kept.\n"
+            << "With --json, strings are kept.\n"
+            << "With --csv / --tsv, -c selects a column, starting at 1, with "
+               "an optional size. Without -c, every column is lighten.\n";
+}
+
+void writeOutput(const std::string &output) {
+  if (std::fwrite(output.data(), 1, output.size(), stdout) != output.size()) {
+    throw std::runtime_error("Failed to write output.");
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string path = "-";
+  size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  bool json = false;
+  char separator = '\0';
+  size_t size = 4;
+  std::vector<std::pair<size_t, size_t>> columns;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = std::strtoul(argv[i + 1], nullptr, 10);
+      i++;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      json = true;
+    } else if (strcmp(argv[i], "--csv") == 0) {
+      separator = ',';
+    } else if (strcmp(argv[i], "--tsv") == 0) {
+      separator = '\t';
+    } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      size = std::strtoul(argv[i + 1], nullptr, 10);
+      i++;
+    } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      char *end = nullptr;
+      const size_t column = std::strtoul(argv[i + 1], &end, 10);
+      const size_t column_size =
+          *end == ':' ? std::strtoul(end + 1, nullptr, 10) : 0;
+      if (column == 0) {
+        usage(argv[0]);
+        return 1;
+      }
+      columns.emplace_back(column - 1, column_size);
+      i++;
+    } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+      usage(argv[0]);
+      return 0;
+    } else {
+      path = argv[i];
+    }
+  }
+
+  try {
+    const web_utils::MappedFile file(path);
+
+    if (json) {
+      web_lighten::jsonTo(file.view(), size, chunk_size, writeOutput);
+    } else if (separator == '\0') {
+      web_lighten::textParallel(file.view(), size, threads,
+                                parallel_chunk_size, writeOutput);
+    } else {
+      std::vector<size_t> sizes;
+      for (const auto &[column, column_size] : columns) {
+        sizes.resize(std::max(sizes.size(), column + 1), 0);
+        sizes[column] = column_size == 0 ? size : column_size;
+      }
+      web_lighten::CsvLightener lightener(separator, std::move(sizes),
+                                          columns.empty() ? size : 0);
+
+      std::string_view input = file.view();
+      std::string output;
+      output.reserve(chunk_size + chunk_size / 2);
+      while (!input.empty()) {
+        const std::string_view chunk =
+            input.substr(0, std::min(chunk_size, input.size()));
+        input.remove_prefix(chunk.size());
+        output.clear();
+        lightener.feed(chunk, output);
+        writeOutput(output);
+      }
+      output.clear();
+      lightener.finish(output);
+      writeOutput(output);
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+
+  return std::fflush(stdout) == 0 ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+#include "lighten-csv.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "lighten.h"
+
+namespace web_lighten {
+
+CsvLightener::CsvLightener(char separator, std::vector<size_t> sizes,
+                           size_t default_size)
+    : _separator(separator), _sizes(std::move(sizes)),
+      _default_size(default_size) {}
+
+bool CsvLightener::isFieldEnd(char c) const {
+  return c == _separator || c == '\n' || c == '\r';
+}
+
+void CsvLightener::appendField(std::string_view field, std::string &output) {
+  const size_t size =
+      _column < _sizes.size() ? _sizes[_column] : _default_size;
+  if (size == 0 || field.empty()) {
+    output.append(field);
+  } else {
+    appendNumber(field, size, output);
+  }
+}
+
+void CsvLightener::endField(char c, std::string &output) {
+  output += c;
+  if (c == _separator) {
+    ++_column;
+  } else if (c == '\n') {
+    _column = 0;
+  }
+  // '\r' is followed by '\n' that will reset the column.
+  _state = State::FieldStart;
+}
+
+void CsvLightener::feed(std::string_view chunk, std::string &output) {
+  output.reserve(output.size() + chunk.size());
+
+  size_t i = 0;
+  while (i < chunk.size()) {
+    switch (_state) {
+    case State::FieldStart:
+      if (chunk[i] == '"') {
+        output += '"';
+        _state = State::Quoted;
+        ++i;
+        break;
+      }
+      [[fallthrough]];
+    case State::Unquoted: {
+      size_t end = i;
+      while (end < chunk.size() && !isFieldEnd(chunk[end])) {
+        ++end;
+      }
+      const std::string_view part = chunk.substr(i, end - i);
+      if (end == chunk.size()) {
+        _field.append(part);
+        _state = State::Unquoted;
+        i = end;
+        break;
+      }
+      if (_field.empty()) {
+        appendField(part, output);
+      } else {
+        _field.append(part);
+        appendField(_field, output);
+        _field.clear();
+      }
+      endField(chunk[end], output);
+      i = end + 1;
+      break;
+    }
+    case State::Quoted: {
+      const size_t quote = chunk.find('"', i);
+      if (quote == std::string_view::npos) {
+        output.append(chunk.substr(i));
+        i = chunk.size();
+        break;
+      }
+      output.append(chunk.substr(i, quote + 1 - i));
+      _state = State::QuoteInQuoted;
+      i = quote + 1;
+      break;
+    }
+    case State::QuoteInQuoted:
+      if (chunk[i] == '"') {
+        // Escaped quote.
+        output += '"';
+        _state = State::Quoted;
+        ++i;
+        break;
+      }
+      _state = State::AfterQuote;
+      [[fallthrough]];
+    case State::AfterQuote:
+      if (isFieldEnd(chunk[i])) {
+        endField(chunk[i], output);
+      } else {
+        output += chunk[i];
+      }
+      ++i;
+      break;
+    }
+  }
+}
+
+void CsvLightener::finish(std::string &output) {
+  if (_state == State::Unquoted) {
+    appendField(_field, output);
+    _field.clear();
+  }
+  _state = State::FieldStart;
+  _column = 0;
+}
+
+std::string csv(const std::string &text, char separator,
+                const std::vector<size_t> &sizes, size_t default_size) {
+  CsvLightener lightener(separator, sizes, default_size);
+  std::string retval;
+  lightener.feed(text, retval);
+  lightener.finish(retval);
+  return retval;
+}
+
+} // namespace web_lighten
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace web_lighten {
+
+// Lighten the numbers of some columns of a CSV / TSV stream. The input can be
+// split anywhere: only the end of an unquoted field is buffered between two
+// calls to feed. Quoted fields are kept as is.
+class CsvLightener {
+public:
+  // sizes[i] is the size given to number for the column i. Columns with a
+  // size of 0 are kept. Columns after sizes use default_size.
+  CsvLightener(char separator, std::vector<size_t> sizes,
+               size_t default_size = 0);
+
+  // Append the lighten part of chunk to output.
+  void feed(std::string_view chunk, std::string &output);
+
+  // Flush the last field. The lightener can then be used for a new stream.
+  void finish(std::string &output);
+
+private:
+  enum class State { FieldStart, Unquoted, Quoted, QuoteInQuoted, AfterQuote };
+
+  [[nodiscard]] bool isFieldEnd(char c) const;
+  void appendField(std::string_view field, std::string &output);
+  void endField(char c, std::string &output);
+
+  char _separator;
+  std::vector<size_t> _sizes;
+  size_t _default_size;
+  State _state = State::FieldStart;
+  size_t _column = 0;
+  // Unquoted field cut by the end of the previous chunk.
+  std::string _field;
+};
+
+// Lighten a whole CSV / TSV text with a CsvLightener.
+std::string csv(const std::string &text, char separator,
+                const std::vector<size_t> &sizes, size_t default_size);
+
+} // namespace web_lighten
@@ -0,0 +1,91 @@
+#include "lighten-json.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "lighten.h"
+
+namespace web_lighten {
+
+namespace {
+
+bool isNumberStart(char c) { return c == '-' || (c >= '0' && c <= '9'); }
+
+bool isNumberChar(char c) {
+  return (c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' ||
+         c == 'e' || c == 'E';
+}
+
+// Return the position after the closing quote of the string starting at
+// begin.
+size_t skipString(std::string_view json, size_t begin) {
+  size_t i = begin + 1;
+  while (i < json.size()) {
+    const char c = json[i];
+    if (c == '\\') {
+      i += 2;
+    } else if (c == '"') {
+      return i + 1;
+    } else {
+      ++i;
+    }
+  }
+  return json.size();
+}
+
+// Lighten json from begin and append it to output. Stop at the first token
+// boundary where output has flush_size bytes or more. Return the position
+// reached in json.
+size_t appendJson(std::string_view json, size_t begin, size_t size,
+                  size_t flush_size, std::string &output) {
+  size_t copied = begin;
+  size_t i = begin;
+  while (i < json.size() && output.size() + (i - copied) < flush_size) {
+    const char c = json[i];
+    if (c == '"') {
+      i = skipString(json, i);
+    } else if (isNumberStart(c)) {
+      const size_t number = i;
+      do {
+        ++i;
+      } while (i < json.size() && isNumberChar(json[i]));
+
+      output.append(json.data() + copied, number - copied);
+      appendNumber(json.substr(number, i - number), size, output);
+      copied = i;
+    } else {
+      ++i;
+    }
+  }
+  output.append(json.data() + copied, i - copied);
+  return i;
+}
+
+} // namespace
+
+void jsonTo(std::string_view json, size_t size, std::string &output) {
+  output.reserve(output.size() + json.size());
+  appendJson(json, 0, size, std::string::npos, output);
+}
+
+void jsonTo(std::string_view json, size_t size, size_t chunk_size,
+            const std::function<void(const std::string &)> &write) {
+  std::string output;
+  output.reserve(chunk_size + chunk_size / 2);
+  size_t i = 0;
+  while (i < json.size()) {
+    output.clear();
+    i = appendJson(json, i, size, chunk_size, output);
+    write(output);
+  }
+}
+
+std::string json(const std::string &text, size_t size) {
+  std::string retval;
+  jsonTo(text, size, retval);
+  return retval;
+}
+
+} // namespace web_lighten
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace web_lighten {
+
+// Append json to output with every number lighten by numberTo. Strings and
+// everything else, including the formatting, are copied as is. The input is
+// not validated.
+void jsonTo(std::string_view json, size_t size, std::string &output);
+
+// Like jsonTo, but the output is given to write about every chunk_size bytes,
+// so a large file is never held whole in memory.
+void jsonTo(std::string_view json, size_t size, size_t chunk_size,
+            const std::function<void(const std::string &)> &write);
+
+std::string json(const std::string &text, size_t size);
+
+} // namespace web_lighten
@@ -0,0 +1,28 @@
+#include "lighten-parallel.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "lighten-text.h"
+#include "parallel-chunks.h"
+
+namespace web_lighten {
+
+void textParallel(std::string_view text, size_t size, size_t threads,
+                  size_t chunk_size,
+                  const std::function<void(const std::string &)> &write) {
+  const std::vector<std::string_view> chunks =
+      web_utils::splitChunks(text, chunk_size, " \t\r\n");
+
+  web_utils::processChunksInOrder(
+      chunks, threads,
+      [size](std::string_view chunk, std::string &output) {
+        textTo(chunk, size, output);
+      },
+      write);
+}
+
+} // namespace web_lighten
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace web_lighten {
+
+// Same as textTo on a pool of threads. text is cut on whitespace in chunks of
+// about chunk_size bytes and write is called with the lighten chunks in
+// order. Memory is bounded by a few chunks per thread.
+void textParallel(std::string_view text, size_t size, size_t threads,
+                  size_t chunk_size,
+                  const std::function<void(const std::string &)> &write);
+
+} // namespace web_lighten
@@ -0,0 +1,127 @@
+#include "lighten-simd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+namespace web_lighten {
+
+namespace {
+
+uint64_t lengthMask(size_t length) {
+  return length >= block_size ? ~uint64_t{0} : (uint64_t{1} << length) - 1;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+__attribute__((target("avx2"))) uint64_t bits(__m256i mask) {
+  return static_cast<uint32_t>(_mm256_movemask_epi8(mask));
+}
+
+__attribute__((target("avx2"))) CharClasses classifyAvx2(const char *block,
+                                                          size_t length) {
+  const __m256i zero = _mm256_set1_epi8('0');
+  const __m256i nine = _mm256_set1_epi8('9');
+  const __m256i dot = _mm256_set1_epi8('.');
+  const __m256i max_digit = _mm256_set1_epi8(9);
+
+  CharClasses retval{};
+  for (size_t i = 0; i < block_size; i += 32) {
+    const __m256i chars =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + i));
+    const __m256i values = _mm256_sub_epi8(chars, zero);
+    const __m256i digits =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(values, max_digit), values);
+    retval.digits |= bits(digits) << i;
+    retval.zeros |= bits(_mm256_cmpeq_epi8(chars, zero)) << i;
+    retval.nines |= bits(_mm256_cmpeq_epi8(chars, nine)) << i;
+    retval.dots |= bits(_mm256_cmpeq_epi8(chars, dot)) << i;
+  }
+
+  const uint64_t mask = lengthMask(length);
+  retval.digits &= mask;
+  retval.zeros &= mask;
+  retval.nines &= mask;
+  retval.dots &= mask;
+  return retval;
+}
+
+using Classify = CharClasses (*)(const char *, size_t);
+
+Classify selectClassify() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") ? classifyAvx2 : classifyScalar;
+}
+
+#elif defined(__wasm_simd128__)
+
+uint64_t bits(v128_t mask) {
+  return static_cast<uint16_t>(wasm_i8x16_bitmask(mask));
+}
+
+CharClasses classifySimd128(const char *block, size_t length) {
+  const v128_t zero = wasm_i8x16_splat('0');
+  const v128_t nine = wasm_i8x16_splat('9');
+  const v128_t dot = wasm_i8x16_splat('.');
+  const v128_t max_digit = wasm_i8x16_splat(9);
+
+  CharClasses retval{};
+  for (size_t i = 0; i < block_size; i += 16) {
+    const v128_t chars = wasm_v128_load(block + i);
+    const v128_t values = wasm_i8x16_sub(chars, zero);
+    const v128_t digits =
+        wasm_i8x16_eq(wasm_u8x16_min(values, max_digit), values);
+    retval.digits |= bits(digits) << i;
+    retval.zeros |= bits(wasm_i8x16_eq(chars, zero)) << i;
+    retval.nines |= bits(wasm_i8x16_eq(chars, nine)) << i;
+    retval.dots |= bits(wasm_i8x16_eq(chars, dot)) << i;
+  }
+
+  const uint64_t mask = lengthMask(length);
+  retval.digits &= mask;
+  retval.zeros &= mask;
+  retval.nines &= mask;
+  retval.dots &= mask;
+  return retval;
+}
+
+#endif
+
+} // namespace
+
+CharClasses classifyScalar(const char *block, size_t length) {
+  CharClasses retval{};
+  for (size_t i = 0; i < length && i < block_size; ++i) {
+    const char c = block[i];
+    const uint64_t bit = uint64_t{1} << i;
+    if (c >= '0' && c <= '9') {
+      retval.digits |= bit;
+    }
+    if (c == '0') {
+      retval.zeros |= bit;
+    } else if (c == '9') {
+      retval.nines |= bit;
+    } else if (c == '.') {
+      retval.dots |= bit;
+    }
+  }
+  return retval;
+}
+
+CharClasses classify(const char *block, size_t length) {
+#if defined(__x86_64__) || defined(__i386__)
+  static const Classify impl = selectClassify();
+  return impl(block, length);
+#elif defined(__wasm_simd128__)
+  return classifySimd128(block, length);
+#else
+  return classifyScalar(block, length);
+#endif
+}
+
+} // namespace web_lighten
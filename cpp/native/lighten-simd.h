@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace web_lighten {
+
+// One bit per char of a block: bit i is set if block[i] is in the class.
+struct CharClasses {
+  uint64_t digits;
+  uint64_t zeros;
+  uint64_t nines;
+  uint64_t dots;
+};
+
+constexpr size_t block_size = 64;
+
+// block must be readable for block_size chars. Bits after length are
+// cleared.
+CharClasses classifyScalar(const char *block, size_t length);
+
+// Same as classifyScalar with AVX2 or wasm simd128 when available.
+CharClasses classify(const char *block, size_t length);
+
+// Return the mask of the first char of every run of size set bits.
+constexpr uint64_t findRuns(uint64_t mask, size_t size) {
+  uint64_t retval = mask;
+  for (size_t i = 1; i < size; ++i) {
+    retval &= mask >> i;
+  }
+  return retval;
+}
+
+// Remove the bit at position pos and shift the upper bits down.
+constexpr uint64_t removeBit(uint64_t mask, unsigned pos) {
+  const uint64_t low = (uint64_t{1} << pos) - 1;
+  return (mask & low) | ((mask >> pos >> 1) << pos);
+}
+
+} // namespace web_lighten
@@ -0,0 +1,153 @@
+#include "lighten-strategy.h"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "lighten.h"
+
+namespace web_lighten {
+
+namespace {
+
+// Only decimal numbers are accepted, like numberTo. from_chars also accepts
+// inf and nan but doesn't accept a leading '+'.
+template <typename T> bool parse(std::string_view num, T &value) {
+  NumberParts parts{};
+  if (!parseNumber(num, parts)) {
+    return false;
+  }
+  num.remove_prefix(num[0] == '+' ? 1 : 0);
+  const char *end = num.data() + num.size();
+  const std::from_chars_result result =
+      std::from_chars(num.data(), end, value);
+  return result.ec == std::errc() && result.ptr == end;
+}
+
+template <typename T>
+size_t shortestTo(std::string_view num, char *output) {
+  T value;
+  if (!parse(num, value)) {
+    return 0;
+  }
+  const std::to_chars_result result =
+      std::to_chars(output, output + lightenMaxLength(num.size()), value);
+  return result.ptr - output;
+}
+
+size_t precisionTo(std::string_view num, size_t size, char *output) {
+  if (size == 0 || size > 17) {
+    throw std::runtime_error("The parameter size must be between 1 and 17.");
+  }
+  double value;
+  if (!parse(num, value)) {
+    return 0;
+  }
+  const std::to_chars_result result =
+      std::to_chars(output, output + lightenMaxLength(num.size()), value,
+                    std::chars_format::general, static_cast<int>(size));
+  return result.ptr - output;
+}
+
+template <typename T>
+void lightenValuesImpl(const T *values, size_t count, Strategy strategy,
+                       size_t size, T *output) {
+  char number[32];
+  char lighten[lightenMaxLength(sizeof(number))];
+  for (size_t i = 0; i < count; ++i) {
+    T value = values[i];
+    const std::to_chars_result printed =
+        std::to_chars(number, number + sizeof(number), value);
+    const size_t length =
+        lightenTo(std::string_view(number, printed.ptr - number), strategy,
+                  size, lighten);
+    if (length != 0) {
+      std::from_chars(lighten, lighten + length, value);
+    }
+    output[i] = value;
+  }
+}
+
+} // namespace
+
+size_t lightenTo(std::string_view num, Strategy strategy, size_t size,
+                 char *output) {
+  switch (strategy) {
+  case Strategy::Runs:
+    return numberTo(num, size, output);
+  case Strategy::ShortestDouble:
+    return shortestTo<double>(num, output);
+  case Strategy::ShortestFloat:
+    return shortestTo<float>(num, output);
+  case Strategy::Precision:
+    return precisionTo(num, size, output);
+  }
+  throw std::runtime_error("Unknown strategy.");
+}
+
+void appendLighten(std::string_view num, Strategy strategy, size_t size,
+                   std::string &output) {
+  const size_t offset = output.size();
+  output.resize(offset + lightenMaxLength(num.size()));
+  const size_t length = lightenTo(num, strategy, size, output.data() + offset);
+  if (length == 0) {
+    output.replace(offset, output.size() - offset, num);
+  } else {
+    output.resize(offset + length);
+  }
+}
+
+void lightenBatchTo(std::string_view numbers, char separator,
+                    Strategy strategy, size_t size, std::string &output) {
+  output.reserve(output.size() + numbers.size());
+  while (true) {
+    const size_t end = numbers.find(separator);
+    appendLighten(numbers.substr(0, end), strategy, size, output);
+    if (end == std::string_view::npos) {
+      return;
+    }
+    output += separator;
+    numbers.remove_prefix(end + 1);
+  }
+}
+
+void lightenValues(const double *values, size_t count, Strategy strategy,
+                   size_t size, double *output) {
+  lightenValuesImpl(values, count, strategy, size, output);
+}
+
+void lightenValues(const float *values, size_t count, Strategy strategy,
+                   size_t size, float *output) {
+  lightenValuesImpl(values, count, strategy, size, output);
+}
+
+void lightenPackedTo(std::string_view text, const uint32_t *offsets,
+                     size_t count, Strategy strategy, size_t size,
+                     std::string &output,
+                     std::vector<uint32_t> &output_offsets) {
+  output.reserve(output.size() + text.size());
+  output_offsets.reserve(output_offsets.size() + count + 1);
+  output_offsets.push_back(static_cast<uint32_t>(output.size()));
+  for (size_t i = 0; i < count; ++i) {
+    if (offsets[i] > offsets[i + 1] || offsets[i + 1] > text.size()) {
+      throw std::runtime_error("Invalid offsets.");
+    }
+    appendLighten(text.substr(offsets[i], offsets[i + 1] - offsets[i]),
+                  strategy, size, output);
+    output_offsets.push_back(static_cast<uint32_t>(output.size()));
+  }
+}
+
+std::string lightenBatch(const std::string &numbers, char separator,
+                         Strategy strategy, size_t size) {
+  std::string retval;
+  lightenBatchTo(numbers, separator, strategy, size, retval);
+  return retval;
+}
+
+} // namespace web_lighten
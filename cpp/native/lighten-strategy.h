@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "lighten.h"
+
+namespace web_lighten {
+
+enum class Strategy : uint8_t {
+  // Truncate on the first run of size '0' or '9' with numberTo.
+  Runs,
+  // Shortest string that is parsed back to the same double.
+  ShortestDouble,
+  // Shortest string that is parsed back to the same float.
+  ShortestFloat,
+  // Round the double to size significant digits (1 to 17) like printf %g.
+  Precision,
+};
+
+// Size of the buffer needed by lightenTo for a number of length chars.
+constexpr size_t lightenMaxLength(size_t length) {
+  return std::max<size_t>(numberMaxLength(length), 32);
+}
+
+// Write the lighten num to output that must hold at least
+// lightenMaxLength(num.size()) chars. Return the number of chars written or 0
+// if num is not a valid number.
+size_t lightenTo(std::string_view num, Strategy strategy, size_t size,
+                 char *output);
+
+// Append the lighten num to output. num is kept if it's not a valid number.
+void appendLighten(std::string_view num, Strategy strategy, size_t size,
+                   std::string &output);
+
+// Lighten every number of numbers separated by separator and append them to
+// output with the same separators.
+void lightenBatchTo(std::string_view numbers, char separator,
+                    Strategy strategy, size_t size, std::string &output);
+
+std::string lightenBatch(const std::string &numbers, char separator,
+                         Strategy strategy, size_t size);
+
+// Lighten count values printed with their shortest representation and write
+// the values parsed back to output. output may be values.
+void lightenValues(const double *values, size_t count, Strategy strategy,
+                   size_t size, double *output);
+void lightenValues(const float *values, size_t count, Strategy strategy,
+                   size_t size, float *output);
+
+// Lighten the count numbers packed in text: number i is
+// text[offsets[i], offsets[i + 1]). They are appended to output and their end
+// offsets to output_offsets, after the start offset of the first one.
+void lightenPackedTo(std::string_view text, const uint32_t *offsets,
+                     size_t count, Strategy strategy, size_t size,
+                     std::string &output,
+                     std::vector<uint32_t> &output_offsets);
+
+} // namespace web_lighten
@@ -0,0 +1,70 @@
+#include "lighten-text.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "lighten.h"
+
+namespace web_lighten {
+
+namespace {
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+bool isNumberStart(char c) {
+  return isDigit(c) || c == '-' || c == '+' || c == '.';
+}
+
+bool isNumberChar(char c) {
+  return isNumberStart(c) || c == 'e' || c == 'E';
+}
+
+bool isWordChar(char c) {
+  return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         c == '_';
+}
+
+} // namespace
+
+void textTo(std::string_view text, size_t size, std::string &output) {
+  output.reserve(output.size() + text.size());
+
+  size_t copied = 0;
+  size_t i = 0;
+  while (i < text.size()) {
+    const char c = text[i];
+    if (isNumberStart(c)) {
+      const size_t begin = i;
+      do {
+        ++i;
+      } while (i < text.size() && isNumberChar(text[i]));
+      if (i < text.size() && isWordChar(text[i])) {
+        // Unit or suffix: keep the whole word.
+        while (i < text.size() && (isWordChar(text[i]) || text[i] == '.')) {
+          ++i;
+        }
+        continue;
+      }
+      output.append(text.data() + copied, begin - copied);
+      appendNumber(text.substr(begin, i - begin), size, output);
+      copied = i;
+    } else if (isWordChar(c)) {
+      // Identifier: its digits are not a number.
+      do {
+        ++i;
+      } while (i < text.size() && (isWordChar(text[i]) || text[i] == '.'));
+    } else {
+      ++i;
+    }
+  }
+  output.append(text.data() + copied, text.size() - copied);
+}
+
+std::string text(const std::string &text, size_t size) {
+  std::string retval;
+  textTo(text, size, retval);
+  return retval;
+}
+
+} // namespace web_lighten
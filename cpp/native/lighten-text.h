@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace web_lighten {
+
+// Append text to output with every number lighten by appendNumber. A number
+// is a run of [0-9.eE+-] that is not part of a word like "x1.5" or "1.5px".
+// Everything else is copied as is. Numbers never contain whitespace so text
+// can be cut on whitespace.
+void textTo(std::string_view text, size_t size, std::string &output);
+
+std::string text(const std::string &text, size_t size);
+
+} // namespace web_lighten
@@ -1,120 +1,300 @@
-#include <cctype>
-#include <cmath>
+#include "lighten.h"
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+
+#include "lighten-simd.h"
 
 namespace web_lighten {
 
 namespace {
-std::string dec(const std::string &num);
-
-std::string inc(const std::string &num) {
-  if (num[0] == '-') {
-    std::string positive = num.substr(1);
-    return "-" + dec(positive);
-  }
-
-  std::string retval = num;
-  int more = 1;
-  for (int i = retval.size() - 1; i >= 0 && more > 0; --i) {
-    if (retval[i] == '9') {
-      retval[i] = '0';
-    } else {
-      retval[i]++;
-      more = 0;
+
+bool isDigit(char c) { return static_cast<unsigned char>(c - '0') <= 9; }
+
+size_t skipDigits(std::string_view num, size_t i) {
+  while (i < num.size() && isDigit(num[i])) {
+    ++i;
+  }
+  return i;
+}
+
+// Where is the first run of size '0' or '9' in the mantissa.
+struct Scan {
+  NumberParts parts;
+  bool found = false;
+  char run_digit = '\0';
+  // Position of the first char of the run.
+  size_t run_begin = 0;
+  // Number of digits before the run.
+  size_t run_index = 0;
+
+  [[nodiscard]] bool hasDot() const {
+    return parts.fraction != parts.integer_end;
+  }
+};
+
+void scanChars(std::string_view mantissa, size_t size, Scan &scan) {
+  size_t digits = 0;
+  size_t run = 0;
+  for (size_t i = scan.parts.integer; i < mantissa.size(); ++i) {
+    const char c = mantissa[i];
+    if (c == '.') {
+      continue;
+    }
+    if (c != scan.run_digit) {
+      scan.run_digit = c;
+      run = 0;
+      scan.run_begin = i;
+      scan.run_index = digits;
+    }
+    ++digits;
+    ++run;
+    if (run == size && (c == '0' || c == '9')) {
+      scan.found = true;
+      return;
+    }
+  }
+}
+
+// Same as parseNumber and scanChars on a whole block with classify. Return
+// false if the block is not a decimal number.
+bool scanBlock(std::string_view num, size_t size, Scan &scan) {
+  const size_t length = num.size();
+  char block[block_size] = {};
+  memcpy(block, num.data(), length);
+  const CharClasses classes = classify(block, length);
+
+  const size_t sign =
+      length != 0 && (num[0] == '-' || num[0] == '+') ? 1 : 0;
+  const uint64_t all =
+      length == block_size ? ~uint64_t{0} : (uint64_t{1} << length) - 1;
+  const uint64_t others = all & ~classes.digits & ~((uint64_t{1} << sign) - 1);
+
+  // The first char that is not a digit nor a '.' starts the exponent.
+  size_t exponent = length;
+  if (const uint64_t not_dots = others & ~classes.dots; not_dots != 0) {
+    exponent = __builtin_ctzll(not_dots);
+    size_t exponent_digits = exponent + 1;
+    if ((num[exponent] | 0x20) != 'e') {
+      return false;
+    }
+    if (exponent_digits < length &&
+        (num[exponent_digits] == '-' || num[exponent_digits] == '+')) {
+      ++exponent_digits;
+    }
+    if (exponent_digits == length || (others >> exponent_digits) != 0) {
+      return false;
     }
   }
-  if (more > 0) {
-    retval.insert(retval.begin(), '1');
+
+  const uint64_t mantissa =
+      exponent == block_size ? ~uint64_t{0} : (uint64_t{1} << exponent) - 1;
+  const uint64_t mantissa_others = others & mantissa;
+  if ((classes.digits & mantissa) == 0 ||
+      (mantissa_others & (mantissa_others - 1)) != 0) {
+    return false;
   }
-  return retval;
+
+  const unsigned dot =
+      mantissa_others == 0 ? exponent : __builtin_ctzll(mantissa_others);
+  scan.parts = {sign, dot, mantissa_others == 0 ? exponent : dot + 1,
+                exponent};
+
+  uint64_t zeros = classes.zeros & mantissa;
+  uint64_t nines = classes.nines & mantissa;
+  if (scan.hasDot()) {
+    // Runs continue over the decimal separator.
+    zeros = removeBit(zeros, dot);
+    nines = removeBit(nines, dot);
+  }
+
+  const uint64_t runs = findRuns(zeros, size) | findRuns(nines, size);
+  if (runs == 0) {
+    return true;
+  }
+  const size_t first = __builtin_ctzll(runs);
+  scan.found = true;
+  scan.run_digit = (zeros >> first) & 1 ? '0' : '9';
+  scan.run_index = first - sign;
+  scan.run_begin = scan.hasDot() && first >= dot ? first + 1 : first;
+  return true;
 }
 
-std::string dec(const std::string &num) {
-  if (num[0] == '-') {
-    std::string positive = num.substr(1);
-    return "-" + inc(positive);
+size_t write(std::string_view mantissa, const Scan &scan, char *output) {
+  const size_t length = mantissa.size();
+  memcpy(output, mantissa.data(), length);
+
+  const size_t sign = scan.parts.integer;
+  const size_t int_end = scan.parts.integer_end;
+
+  if (!scan.found) {
+    // Remove trailing decimal separator.
+    return scan.hasDot() && scan.parts.fraction == length ? int_end : length;
   }
 
-  std::string retval = num;
-  int less = 1;
-  for (int i = retval.size() - 1; i >= 0 && less > 0; --i) {
-    if (retval[i] == '0') {
-      retval[i] = '9';
-    } else {
-      retval[i]--;
-      less = 0;
+  if (scan.run_digit == '9') {
+    if (scan.run_index == 0) {
+      output[sign] = '1';
+      memset(output + sign + 1, '0', int_end - sign);
+      return int_end + 1;
+    }
+    // The digit before the run is not a '9' so there is no carry.
+    size_t previous = scan.run_begin - 1;
+    if (scan.hasDot() && previous == int_end) {
+      --previous;
     }
+    ++output[previous];
   }
-  if (retval[0] == '0' && retval.size() > 1) {
-    retval.erase(retval.begin());
+
+  if (scan.hasDot() && scan.run_begin > int_end + 1) {
+    return scan.run_begin;
   }
-  return retval;
-}
 
-} // namespace
+  if (int_end == sign) {
+    output[sign] = '0';
+    return sign + 1;
+  }
 
-std::string number(std::string num, size_t size) {
-  if (size > 9) {
-    throw std::runtime_error("The parameter size must be smaller than 10.");
+  if (scan.run_begin < int_end) {
+    memset(output + scan.run_begin, '0', int_end - scan.run_begin);
   }
+  return int_end;
+}
 
-  size_t pos_null = num.find('\0');
-  if (pos_null != std::string::npos) {
-    num.resize(pos_null);
+// Rewrite exponent + shift in output with the same style: 'e' or 'E', explicit
+// '+' and number of digits. Return 0 if exponent is too large.
+size_t shiftExponent(std::string_view exponent, size_t shift, char *output) {
+  size_t i = 1;
+  const bool negative = exponent[i] == '-';
+  const bool plus = exponent[i] == '+';
+  if (negative || plus) {
+    ++i;
   }
+  const size_t width = exponent.size() - i;
+  if (width > 15 || shift > 1000) {
+    return 0;
+  }
+  int64_t value = 0;
+  for (; i < exponent.size(); ++i) {
+    value = value * 10 + (exponent[i] - '0');
+  }
+  value = (negative ? -value : value) + static_cast<int64_t>(shift);
 
-  char *end = nullptr;
-  long double val = strtold(num.c_str(), &end);
-  bool valid_number = end != num.c_str() && *end == '\0' && val != HUGE_VALL &&
-                      !isspace(num[0]);
+  char digits[20];
+  const size_t length =
+      std::to_chars(digits, digits + sizeof(digits), value < 0 ? -value : value)
+          .ptr -
+      digits;
 
-  if (!valid_number) {
-    return {};
+  size_t retval = 0;
+  output[retval++] = exponent[0];
+  if (value < 0) {
+    output[retval++] = '-';
+  } else if (plus) {
+    output[retval++] = '+';
   }
+  for (size_t pad = length; pad < width; ++pad) {
+    output[retval++] = '0';
+  }
+  memcpy(output + retval, digits, length);
+  return retval + length;
+}
 
-  // Remove decimal separator
-  size_t pos = num.find('.');
-  if (pos != std::string::npos) {
-    num = num.substr(0, pos) + num.substr(pos + 1, num.length() - pos - 1);
-  } else {
-    pos = num.length();
-  }
-
-  // Truncate if 0000 is found.
-  size_t pos0000 = num.find(std::string(size, '0'));
-  if (pos0000 != std::string::npos) {
-    num = num.substr(0, pos0000);
-  }
-
-  // Truncate if 9999 is found.
-  size_t pos9999 = num.find(std::string(size, '9'));
-  if (pos9999 != std::string::npos) {
-    num = num.substr(0, pos9999);
-    size_t old_length = num.length();
-    if (old_length == 0) {
-      num = "1";
-    } else if (old_length == 1 && num[0] == '-') {
-      num = "-1";
-    } else {
-      if (num[0] == '-') {
-        num = dec(num);
-      } else {
-        num = inc(num);
+// Append the exponent to the lighten mantissa of length chars. If the
+// rounding carried up to a new digit, the mantissa is "1" followed by '0' and
+// the zeros are moved into the exponent: 9.9999e5 becomes 1e6, not 10e5.
+size_t writeExponent(std::string_view exponent, const Scan &scan,
+                     char *output, size_t length) {
+  if (scan.found && scan.run_digit == '9' && scan.run_index == 0) {
+    const size_t one = scan.parts.integer + 1;
+    const size_t shift = length - one;
+    if (shift != 0) {
+      if (const size_t written =
+              shiftExponent(exponent, shift, output + one);
+          written != 0) {
+        return one + written;
       }
     }
-    pos = pos - old_length + num.length();
   }
 
-  if (pos != std::string::npos) {
-    if (pos > num.length()) {
-      num = num + std::string(pos - num.length(), '0');
-    } else if (pos < num.length()) {
-      num = num.substr(0, pos) + '.' + num.substr(pos, num.length() - pos);
+  memcpy(output + length, exponent.data(), exponent.size());
+  return length + exponent.size();
+}
+
+} // namespace
+
+bool parseNumber(std::string_view num, NumberParts &parts) {
+  size_t i = !num.empty() && (num[0] == '-' || num[0] == '+') ? 1 : 0;
+  parts.integer = i;
+  i = skipDigits(num, i);
+  parts.integer_end = i;
+  if (i < num.size() && num[i] == '.') {
+    ++i;
+  }
+  parts.fraction = i;
+  i = skipDigits(num, i);
+  parts.exponent = i;
+  if (parts.integer_end == parts.integer && parts.exponent == parts.fraction) {
+    return false;
+  }
+  if (i == num.size()) {
+    return true;
+  }
+
+  if ((num[i] | 0x20) != 'e') {
+    return false;
+  }
+  ++i;
+  if (i < num.size() && (num[i] == '-' || num[i] == '+')) {
+    ++i;
+  }
+  const size_t exponent_digits = i;
+  i = skipDigits(num, i);
+  return i != exponent_digits && i == num.size();
+}
+
+size_t numberTo(std::string_view num, size_t size, char *output) {
+  if (size == 0 || size > 9) {
+    throw std::runtime_error("The parameter size must be between 1 and 9.");
+  }
+
+  num = num.substr(0, num.find('\0'));
+
+  Scan scan;
+  if (num.size() > block_size || !scanBlock(num, size, scan)) {
+    if (!parseNumber(num, scan.parts)) {
+      return 0;
     }
+    scanChars(num.substr(0, scan.parts.exponent), size, scan);
   }
 
-  return num;
+  const size_t length =
+      write(num.substr(0, scan.parts.exponent), scan, output);
+  if (scan.parts.exponent == num.size()) {
+    return length;
+  }
+  return writeExponent(num.substr(scan.parts.exponent), scan, output, length);
+}
+
+void appendNumber(std::string_view num, size_t size, std::string &output) {
+  const size_t offset = output.size();
+  output.resize(offset + numberMaxLength(num.size()));
+  const size_t length = numberTo(num, size, output.data() + offset);
+  if (length == 0) {
+    output.replace(offset, output.size() - offset, num);
+  } else {
+    output.resize(offset + length);
+  }
+}
+
+std::string number(const std::string &num, size_t size) {
+  std::string retval(numberMaxLength(num.size()), '\0');
+  retval.resize(numberTo(num, size, retval.data()));
+  return retval;
 }
 
 } // namespace web_lighten
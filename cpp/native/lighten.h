@@ -1,7 +1,40 @@
+#pragma once
+
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace web_lighten {
 
-std::string number(std::string num, size_t size);
+std::string number(const std::string &num, size_t size);
+
+// Split points of a decimal number [+-]digits[.digits][(e|E)[+-]digits].
+// For "-12.34e-5": integer = 1, integer_end = 3, fraction = 4, exponent = 6.
+struct NumberParts {
+  // First char after the sign.
+  size_t integer;
+  // Position of '.', or of the exponent / the end if there is no '.'.
+  size_t integer_end;
+  // Fraction digits are [fraction, exponent). fraction == integer_end if
+  // there is no '.'.
+  size_t fraction;
+  // Position of 'e' / 'E', or the end if there is no exponent.
+  size_t exponent;
+};
+
+// Return false if num is not a decimal number. At least one digit is needed
+// in the integer or the fraction part.
+bool parseNumber(std::string_view num, NumberParts &parts);
+
+// Size of the buffer needed by numberTo for a number of length chars.
+constexpr size_t numberMaxLength(size_t length) { return length + 1; }
+
+// Write the lighten num to output that must hold at least
+// numberMaxLength(num.size()) chars and must not overlap num.
+// Return the number of chars written or 0 if num is not a valid number.
+size_t numberTo(std::string_view num, size_t size, char *output);
+
+// Append the lighten num to output. num is kept if it's not a valid number.
+void appendNumber(std::string_view num, size_t size, std::string &output);
 
 } // namespace web_lighten
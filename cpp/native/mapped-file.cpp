@@ -0,0 +1,94 @@
+#include "mapped-file.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace web_utils {
+
+namespace {
+
+// Read fd until its end, for the files that can't be mmap'ed: pipes,
+// /dev/stdin, <(...), ... Their st_size is 0.
+void readAll(int fd, const std::string &path, std::string &buffer) {
+  constexpr size_t block_size = 1024 * 1024;
+  while (true) {
+    const size_t size = buffer.size();
+    buffer.resize(size + block_size);
+    const ssize_t count = read(fd, buffer.data() + size, block_size);
+    if (count < 0 && errno == EINTR) {
+      buffer.resize(size);
+      continue;
+    }
+    if (count < 0) {
+      buffer.resize(size);
+      throw std::runtime_error("Failed to read " + path + ".");
+    }
+    buffer.resize(size + static_cast<size_t>(count));
+    if (count == 0) {
+      return;
+    }
+  }
+}
+
+} // namespace
+
+MappedFile::MappedFile(const std::string &path) {
+  if (path == "-") {
+    readAll(STDIN_FILENO, path, _buffer);
+    return;
+  }
+
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open " + path + ".");
+  }
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    throw std::runtime_error("Failed to stat " + path + ".");
+  }
+  if (!S_ISREG(file_stat.st_mode)) {
+    try {
+      readAll(fd, path, _buffer);
+    } catch (...) {
+      close(fd);
+      throw;
+    }
+    close(fd);
+    return;
+  }
+  _size = static_cast<size_t>(file_stat.st_size);
+  if (_size != 0) {
+    _mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (_mapping == MAP_FAILED) {
+      _mapping = nullptr;
+      _size = 0;
+      close(fd);
+      throw std::runtime_error("Failed to mmap " + path + ".");
+    }
+    madvise(_mapping, _size, MADV_SEQUENTIAL);
+  }
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (_mapping != nullptr) {
+    munmap(_mapping, _size);
+  }
+}
+
+std::string_view MappedFile::view() const {
+  if (_mapping != nullptr) {
+    return {static_cast<const char *>(_mapping), _size};
+  }
+  return _buffer;
+}
+
+} // namespace web_utils
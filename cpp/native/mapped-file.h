@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace web_utils {
+
+// Read-only view of a whole file. A regular file is mmap'ed, anything else
+// (pipe, /dev/stdin, stdin with "-") is read in memory.
+class MappedFile {
+public:
+  explicit MappedFile(const std::string &path);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile &operator=(MappedFile &&) = delete;
+  ~MappedFile();
+
+  [[nodiscard]] std::string_view view() const;
+
+private:
+  void *_mapping = nullptr;
+  size_t _size = 0;
+  std::string _buffer;
+};
+
+} // namespace web_utils
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace web_utils {
+
+// Split input in chunks of about chunk_size bytes. Each chunk, but the last
+// one, ends just after one of the separators.
+inline std::vector<std::string_view> splitChunks(std::string_view input,
+                                                 size_t chunk_size,
+                                                 std::string_view separators) {
+  std::vector<std::string_view> retval;
+  retval.reserve(input.size() / std::max<size_t>(chunk_size, 1) + 1);
+  size_t start = 0;
+  while (start < input.size()) {
+    size_t end = input.find_first_of(separators, start + chunk_size);
+    end = end == std::string_view::npos ? input.size() : end + 1;
+    retval.push_back(input.substr(start, end - start));
+    start = end;
+  }
+  return retval;
+}
+
+// Run process(chunk, output) on a pool of threads and call write(output) with
+// the results in the same order than chunks. Each worker runs at most
+// 2 * threads chunks ahead of the writer to keep memory bounded.
+template <typename Process, typename Write>
+void processChunksInOrder(const std::vector<std::string_view> &chunks,
+                          size_t threads, Process &&process, Write &&write) {
+  threads = std::max<size_t>(1, std::min(threads, chunks.size()));
+  const size_t window = threads * 2;
+
+  std::vector<std::string> outputs(chunks.size());
+  std::vector<char> ready(chunks.size(), 0);
+  std::atomic<size_t> next{0};
+  size_t written = 0;
+  bool failed = false;
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable cv_ready;
+  std::condition_variable cv_space;
+
+  auto worker = [&]() {
+    while (true) {
+      const size_t i = next.fetch_add(1);
+      if (i >= chunks.size()) {
+        return;
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv_space.wait(lock, [&] { return failed || i < written + window; });
+        if (failed) {
+          return;
+        }
+      }
+      std::string output;
+      try {
+        process(chunks[i], output);
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (!failed) {
+          failed = true;
+          error = std::current_exception();
+        }
+        cv_ready.notify_all();
+        cv_space.notify_all();
+        return;
+      }
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        outputs[i] = std::move(output);
+        ready[i] = 1;
+      }
+      cv_ready.notify_all();
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads);
+  for (size_t i = 0; i < threads; i++) {
+    pool.emplace_back(worker);
+  }
+
+  for (size_t i = 0; i < chunks.size(); i++) {
+    std::string output;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv_ready.wait(lock, [&] { return failed || ready[i] != 0; });
+      if (failed) {
+        break;
+      }
+      output = std::move(outputs[i]);
+    }
+    try {
+      write(output);
+    } catch (...) {
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (!failed) {
+        failed = true;
+        error = std::current_exception();
+      }
+      cv_space.notify_all();
+      break;
+    }
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      written = i + 1;
+    }
+    cv_space.notify_all();
+  }
+
+  for (auto &thread : pool) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace web_utils
@@ -0,0 +1,90 @@
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../native/demangler-json.h"
+#include "../native/demangler.h"
+#include "benchmark.h"
+
+namespace {
+
+struct Corpus {
+  std::string name;
+  std::string text;
+  std::vector<std::string> symbols;
+};
+
+Corpus loadCorpus(const std::string &directory, const std::string &name) {
+  std::ifstream file(directory + "/" + name + ".txt");
+  if (!file) {
+    throw std::runtime_error("Failed to open corpus " + name + ".");
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  Corpus retval{name, buffer.str(), {}};
+  std::istringstream lines(retval.text);
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (!line.empty()) {
+      retval.symbols.push_back(line);
+    }
+  }
+  return retval;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::string directory = argc > 1 ? argv[1] : "demangler";
+
+  std::vector<web_benchmark::Result> results;
+
+  for (const char *name : {"itanium", "msvc", "rust"}) {
+    const Corpus corpus = loadCorpus(directory, name);
+    const size_t count = corpus.symbols.size();
+    const size_t bytes = corpus.text.size();
+
+    results.push_back(web_benchmark::measure(
+        corpus.name + "/demangle", count, bytes, [&corpus]() {
+          size_t retval = 0;
+          for (const std::string &symbol : corpus.symbols) {
+            retval += web_demangler::demangle(symbol).size();
+          }
+          return retval;
+        }));
+
+    std::string output;
+    results.push_back(web_benchmark::measure(
+        corpus.name + "/demangleTo", count, bytes, [&corpus, &output]() {
+          output.clear();
+          for (const std::string &symbol : corpus.symbols) {
+            web_demangler::demangleTo(symbol, output);
+          }
+          return output.size();
+        }));
+
+    results.push_back(web_benchmark::measure(
+        corpus.name + "/demangleWordsTo", count, bytes, [&corpus, &output]() {
+          output.clear();
+          web_demangler::demangleWordsTo(corpus.text, output);
+          return output.size();
+        }));
+
+    results.push_back(web_benchmark::measure(
+        corpus.name + "/demangleJsonTo", count, bytes, [&corpus, &output]() {
+          output.clear();
+          for (const std::string &symbol : corpus.symbols) {
+            web_demangler::demangleJsonTo(symbol, output);
+          }
+          return output.size();
+        }));
+  }
+
+  web_benchmark::printJson(results, std::cout);
+  return 0;
+}
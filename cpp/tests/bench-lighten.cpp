@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "../native/lighten-csv.h"
+#include "../native/lighten-json.h"
+#include "../native/lighten-parallel.h"
+#include "../native/lighten-simd.h"
+#include "../native/lighten-strategy.h"
+#include "../native/lighten-text.h"
+#include "../native/lighten.h"
+#include "benchmark.h"
+
+namespace {
+
+// Doubles printed with all their digits like most serializers do.
+std::vector<std::string> generateNumbers(size_t count, const char *format) {
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1000., 1000.);
+  std::vector<std::string> retval;
+  retval.reserve(count);
+  char buffer[32];
+  for (size_t i = 0; i < count; ++i) {
+    const double value = distribution(generator);
+    snprintf(buffer, sizeof(buffer), format, value);
+    retval.emplace_back(buffer);
+  }
+  return retval;
+}
+
+struct Corpus {
+  std::string name;
+  std::string text;
+  std::vector<std::string> numbers;
+};
+
+// Numbers are the valid tokens of [0-9.eE+-].
+Corpus loadCorpus(const std::string &directory, const std::string &name) {
+  std::ifstream file(directory + "/" + name);
+  if (!file) {
+    throw std::runtime_error("Failed to open corpus " + name + ".");
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  Corpus retval{name, buffer.str(), {}};
+  const std::string_view text = retval.text;
+  constexpr std::string_view number_chars = "0123456789.eE+-";
+  size_t begin = text.find_first_of(number_chars);
+  while (begin != std::string_view::npos) {
+    const size_t end = std::min(text.find_first_not_of(number_chars, begin),
+                                text.size());
+    const std::string_view token = text.substr(begin, end - begin);
+    web_lighten::NumberParts parts{};
+    if (web_lighten::parseNumber(token, parts)) {
+      retval.numbers.emplace_back(token);
+    }
+    begin = text.find_first_of(number_chars, end);
+  }
+  return retval;
+}
+
+// Benchmarks of the single number API and of the streaming mode of the
+// corpus.
+void measureCorpus(const Corpus &corpus,
+                   std::vector<web_benchmark::Result> &results) {
+  const size_t count = corpus.numbers.size();
+  size_t bytes = 0;
+  for (const std::string &number : corpus.numbers) {
+    bytes += number.size();
+  }
+
+  results.push_back(web_benchmark::measure(
+      corpus.name + "/number", count, bytes, [&corpus]() {
+        size_t retval = 0;
+        for (const std::string &number : corpus.numbers) {
+          retval += web_lighten::number(number, 4).size();
+        }
+        return retval;
+      }));
+
+  std::string output;
+  results.push_back(web_benchmark::measure(
+      corpus.name + "/numberTo", count, bytes, [&corpus, &output]() {
+        size_t retval = 0;
+        for (const std::string &number : corpus.numbers) {
+          output.resize(web_lighten::numberMaxLength(number.size()));
+          retval += web_lighten::numberTo(number, 4, output.data());
+        }
+        return retval;
+      }));
+
+  const size_t text_bytes = corpus.text.size();
+  results.push_back(web_benchmark::measure(
+      corpus.name + "/textTo", count, text_bytes, [&corpus, &output]() {
+        output.clear();
+        web_lighten::textTo(corpus.text, 4, output);
+        return output.size();
+      }));
+
+  const size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  results.push_back(web_benchmark::measure(
+      corpus.name + "/textParallel", count, text_bytes, [&corpus, threads]() {
+        size_t retval = 0;
+        web_lighten::textParallel(
+            corpus.text, 4, threads, 16 * 1024,
+            [&retval](const std::string &chunk) { retval += chunk.size(); });
+        return retval;
+      }));
+
+  const std::string_view extension =
+      std::string_view(corpus.name).substr(corpus.name.rfind('.') + 1);
+  if (extension == "json") {
+    results.push_back(web_benchmark::measure(
+        corpus.name + "/jsonTo", count, text_bytes, [&corpus, &output]() {
+          output.clear();
+          web_lighten::jsonTo(corpus.text, 4, output);
+          return output.size();
+        }));
+  } else if (extension == "csv") {
+    results.push_back(web_benchmark::measure(
+        corpus.name + "/CsvLightener", count, text_bytes,
+        [&corpus, &output]() {
+          web_lighten::CsvLightener lightener(',', {}, 4);
+          output.clear();
+          lightener.feed(corpus.text, output);
+          lightener.finish(output);
+          return output.size();
+        }));
+  } else {
+    for (const auto &[name, strategy, size] :
+         {std::tuple{"Runs", web_lighten::Strategy::Runs, 4},
+          std::tuple{"ShortestDouble", web_lighten::Strategy::ShortestDouble,
+                     0}}) {
+      results.push_back(web_benchmark::measure(
+          corpus.name + "/lightenBatchTo/" + name, count, text_bytes,
+          [&corpus, &output, strategy = strategy, size = size]() {
+            output.clear();
+            web_lighten::lightenBatchTo(corpus.text, '\n', strategy, size,
+                                        output);
+            return output.size();
+          }));
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::string directory = argc > 1 ? argv[1] : "lighten";
+  std::map<std::string, double> baseline;
+  if (argc > 2) {
+    std::ifstream file(argv[2]);
+    baseline = web_benchmark::loadJson(file);
+  }
+
+  const std::vector<std::string> numbers = generateNumbers(100000, "%.17g");
+  size_t bytes = 0;
+  for (const std::string &number : numbers) {
+    bytes += number.size();
+  }
+  const size_t count = numbers.size();
+
+  std::vector<web_benchmark::Result> results;
+
+  std::vector<std::string> blocks;
+  blocks.reserve(count);
+  for (const std::string &number : numbers) {
+    blocks.push_back(number);
+    blocks.back().resize(web_lighten::block_size);
+  }
+  results.push_back(web_benchmark::measure(
+      "classify/scalar", count, bytes, [&blocks, &numbers]() {
+        size_t retval = 0;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+          retval += web_lighten::classifyScalar(blocks[i].data(),
+                                                numbers[i].size())
+                        .zeros;
+        }
+        return retval;
+      }));
+  results.push_back(web_benchmark::measure(
+      "classify/simd", count, bytes, [&blocks, &numbers]() {
+        size_t retval = 0;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+          retval +=
+              web_lighten::classify(blocks[i].data(), numbers[i].size()).zeros;
+        }
+        return retval;
+      }));
+
+  results.push_back(web_benchmark::measure(
+      "number", count, bytes, [&numbers]() {
+        size_t retval = 0;
+        for (const std::string &number : numbers) {
+          retval += web_lighten::number(number, 4).size();
+        }
+        return retval;
+      }));
+
+  std::string output(web_lighten::numberMaxLength(64), '\0');
+  results.push_back(web_benchmark::measure(
+      "numberTo", count, bytes, [&numbers, &output]() {
+        size_t retval = 0;
+        for (const std::string &number : numbers) {
+          retval += web_lighten::numberTo(number, 4, output.data());
+        }
+        return retval;
+      }));
+
+  const std::vector<std::string> scientific =
+      generateNumbers(100000, "%.16e");
+  size_t scientific_bytes = 0;
+  for (const std::string &number : scientific) {
+    scientific_bytes += number.size();
+  }
+  results.push_back(web_benchmark::measure(
+      "numberTo/scientific", scientific.size(), scientific_bytes,
+      [&scientific, &output]() {
+        size_t retval = 0;
+        for (const std::string &number : scientific) {
+          retval += web_lighten::numberTo(number, 4, output.data());
+        }
+        return retval;
+      }));
+
+  std::string json = "[";
+  for (const std::string &number : numbers) {
+    json += number;
+    json += ", ";
+  }
+  json += "0]";
+  std::string lighten;
+  results.push_back(web_benchmark::measure(
+      "jsonTo", count, json.size(), [&json, &lighten]() {
+        lighten.clear();
+        web_lighten::jsonTo(json, 4, lighten);
+        return lighten.size();
+      }));
+
+  results.push_back(web_benchmark::measure(
+      "textTo", count, json.size(), [&json, &lighten]() {
+        lighten.clear();
+        web_lighten::textTo(json, 4, lighten);
+        return lighten.size();
+      }));
+
+  std::string csv;
+  for (size_t i = 0; i < count; ++i) {
+    csv += numbers[i];
+    csv += i % 4 == 3 ? '\n' : ',';
+  }
+  results.push_back(web_benchmark::measure(
+      "CsvLightener", count, csv.size(), [&csv, &lighten]() {
+        web_lighten::CsvLightener lightener(',', {}, 4);
+        lighten.clear();
+        lightener.feed(csv, lighten);
+        lightener.finish(lighten);
+        return lighten.size();
+      }));
+
+  std::string batch;
+  for (const std::string &number : numbers) {
+    batch += number;
+    batch += '\n';
+  }
+  for (const auto &[name, strategy, size] :
+       {std::tuple{"Runs", web_lighten::Strategy::Runs, 4},
+        std::tuple{"ShortestDouble", web_lighten::Strategy::ShortestDouble, 0},
+        std::tuple{"ShortestFloat", web_lighten::Strategy::ShortestFloat, 0},
+        std::tuple{"Precision", web_lighten::Strategy::Precision, 6}}) {
+    results.push_back(web_benchmark::measure(
+        std::string("lightenBatchTo/") + name, count, batch.size(),
+        [&batch, &lighten, strategy = strategy, size = size]() {
+          lighten.clear();
+          web_lighten::lightenBatchTo(batch, '\n', strategy, size, lighten);
+          return lighten.size();
+        }));
+  }
+
+  std::vector<double> values;
+  values.reserve(count);
+  for (const std::string &number : numbers) {
+    values.push_back(std::stod(number));
+  }
+  std::vector<double> lighten_values(count);
+  results.push_back(web_benchmark::measure(
+      "lightenValues/double", count, count * sizeof(double),
+      [&values, &lighten_values]() {
+        web_lighten::lightenValues(values.data(), values.size(),
+                                   web_lighten::Strategy::Runs, 4,
+                                   lighten_values.data());
+        return static_cast<size_t>(lighten_values[0]);
+      }));
+
+  for (const char *name : {"telemetry.json", "measures.csv", "decimals.txt"}) {
+    measureCorpus(loadCorpus(directory, name), results);
+  }
+
+  web_benchmark::printJson(results, std::cout, baseline);
+  return 0;
+}
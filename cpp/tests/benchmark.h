@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace web_benchmark {
+
+struct Result {
+  std::string name;
+  size_t runs;
+  size_t items;
+  size_t bytes;
+  double seconds;
+};
+
+// Make the compiler assume value is read, like benchmark::DoNotOptimize of
+// Google Benchmark, without emitting any code.
+template <typename T> inline void doNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Run func until at least min_seconds elapsed. func must process items_per_run
+// items of bytes_per_run bytes in total and return a value depending on the
+// result. The value goes to doNotOptimize to avoid dead code elimination.
+template <typename Func>
+Result measure(std::string_view name, size_t items_per_run,
+               size_t bytes_per_run, Func &&func, double min_seconds = 0.5) {
+  using Clock = std::chrono::steady_clock;
+
+  size_t runs = 0;
+  const Clock::time_point start = Clock::now();
+  double seconds = 0.;
+  do {
+    doNotOptimize(func());
+    runs++;
+    seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  } while (seconds < min_seconds);
+
+  return {std::string{name}, runs, items_per_run * runs, bytes_per_run * runs,
+          seconds};
+}
+
+// Read the items_per_second of every benchmark of a JSON printed by printJson.
+inline std::map<std::string, double> loadJson(std::istream &is) {
+  std::map<std::string, double> retval;
+  constexpr std::string_view name_key = "{\"name\":\"";
+  constexpr std::string_view items_key = "\"items_per_second\":";
+  std::string line;
+  while (std::getline(is, line)) {
+    const size_t name = line.find(name_key);
+    const size_t items = line.find(items_key);
+    if (name == std::string::npos || items == std::string::npos) {
+      continue;
+    }
+    const size_t name_begin = name + name_key.size();
+    retval[line.substr(name_begin, line.find('"', name_begin) - name_begin)] =
+        std::strtod(line.c_str() + items + items_key.size(), nullptr);
+  }
+  return retval;
+}
+
+// Print results as JSON to allow the comparison of two runs. If a result is
+// in baseline (see loadJson), its speedup against baseline is also printed.
+inline void printJson(const std::vector<Result> &results, std::ostream &os,
+                      const std::map<std::string, double> &baseline = {}) {
+  os << "{\"benchmarks\":[";
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &result = results[i];
+    if (i != 0) {
+      os << ",";
+    }
+    const double items_per_second =
+        static_cast<double>(result.items) / result.seconds;
+    os << "\n  {\"name\":\"" << result.name << "\",\"runs\":" << result.runs
+       << ",\"items_per_second\":" << items_per_second
+       << ",\"bytes_per_second\":"
+       << static_cast<double>(result.bytes) / result.seconds;
+    if (const auto previous = baseline.find(result.name);
+        previous != baseline.end() && previous->second > 0.) {
+      os << ",\"baseline_items_per_second\":" << previous->second
+         << ",\"speedup\":" << items_per_second / previous->second;
+    }
+    os << "}";
+  }
+  os << "\n]}\n";
+}
+
+} // namespace web_benchmark
@@ -0,0 +1,66 @@
+#include "../native/clang-format-config-migrate/reflection.h"
+#include <catch2/catch_test_macros.hpp>
+#include <optional>
+
+using clang_vx::reflection::Category;
+using clang_vx::reflection::enumCast;
+using clang_vx::reflection::enumName;
+using clang_vx::reflection::fieldAddress;
+using clang_vx::reflection::fieldIndex;
+using clang_vx::reflection::Record;
+using clang_vx::reflection::yamlKeyIndex;
+
+TEST_CASE("fieldIndex", "[clang-format-config-migrate-reflection]") {
+  using Style = clang_v21::FormatStyle;
+  const auto &fields = Record<Style>::fields;
+
+  const size_t column_limit = fieldIndex<Style>("ColumnLimit");
+  REQUIRE(column_limit < fields.size());
+  REQUIRE(fields[column_limit].name == "ColumnLimit");
+  REQUIRE(fields[column_limit].category == Category::Unsigned);
+  REQUIRE(fieldIndex<Style>("NotAField") == fields.size());
+
+  Style style{};
+  style.ColumnLimit = 42;
+  REQUIRE(*static_cast<const unsigned *>(fieldAddress(style, column_limit)) ==
+          42);
+
+  const size_t after_class =
+      fieldIndex<Style::BraceWrappingFlags>("AfterClass");
+  REQUIRE(after_class < Record<Style::BraceWrappingFlags>::fields.size());
+  REQUIRE(Record<Style::BraceWrappingFlags>::fields[after_class].category ==
+          Category::Bool);
+}
+
+TEST_CASE("yamlKeyIndex", "[clang-format-config-migrate-reflection]") {
+  using Style = clang_v21::FormatStyle;
+
+  REQUIRE(yamlKeyIndex<Style>("ColumnLimit") ==
+          fieldIndex<Style>("ColumnLimit"));
+  REQUIRE(yamlKeyIndex<Style>("NotAKey") == Record<Style>::fields.size());
+
+  // KeepEmptyLinesAtEOF maps Style.KeepEmptyLines.AtEndOfFile in
+  // MappingTraits<FormatStyle>. It is not the key of the field AtEndOfFile.
+  using KeepEmptyLines = Style::KeepEmptyLinesStyle;
+  REQUIRE(yamlKeyIndex<KeepEmptyLines>("AtEndOfFile") ==
+          fieldIndex<KeepEmptyLines>("AtEndOfFile"));
+  REQUIRE(yamlKeyIndex<KeepEmptyLines>("KeepEmptyLinesAtEOF") ==
+          Record<KeepEmptyLines>::fields.size());
+
+  // Mapped from MappingTraits<FormatStyle> by Style.IncludeStyle.IncludeBlocks.
+  REQUIRE(yamlKeyIndex<clang_v21::IncludeStyle>("IncludeBlocks") ==
+          fieldIndex<clang_v21::IncludeStyle>("IncludeBlocks"));
+
+  // 3.3.0 has no MappingTraits: the key is the name of the field.
+  REQUIRE(yamlKeyIndex<clang_v3_3::FormatStyle>("ColumnLimit") ==
+          fieldIndex<clang_v3_3::FormatStyle>("ColumnLimit"));
+}
+
+TEST_CASE("enumCast", "[clang-format-config-migrate-reflection]") {
+  using LanguageKind = clang_v21::FormatStyle::LanguageKind;
+
+  REQUIRE(enumCast<LanguageKind>("LK_Cpp") ==
+          std::optional<LanguageKind>(clang_v21::FormatStyle::LK_Cpp));
+  REQUIRE(enumCast<LanguageKind>("LK_NotALanguage") == std::nullopt);
+  REQUIRE(enumName(clang_v21::FormatStyle::LK_Cpp) == "LK_Cpp");
+}
@@ -0,0 +1,14 @@
+namespace ns {
+struct Point {
+  int x;
+  int y;
+  int sum() const;
+};
+int Point::sum() const { return x + y; }
+} // namespace ns
+
+int counter = 1;
+int twice(int value) { return 2 * value; }
+extern "C" int plain(int value) { return value + counter; }
+double external(double value);
+double call(double value) { return external(value); }
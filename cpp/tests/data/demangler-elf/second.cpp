@@ -0,0 +1,2 @@
+template <typename T> T half(T value) { return value / 2; }
+template int half(int value);
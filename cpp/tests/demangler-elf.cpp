@@ -0,0 +1,67 @@
+#include "../native/demangler-elf.h"
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// The fixtures of demangler-elf are built by:
+// g++ -c -Os -g0 -fno-asynchronous-unwind-tables -fno-ident object.cpp
+// g++ -c -Os -g0 -fno-asynchronous-unwind-tables -fno-ident second.cpp
+// ar rcsD archive.a object.o second.o
+
+namespace {
+
+std::string readFile(const std::string &name) {
+  std::ifstream file("demangler-elf/" + name, std::ios::binary);
+  REQUIRE(file.is_open());
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+
+const std::string object_symbols =
+    "0000000000000000\t0000000000000000\t*ABS*\tobject.cpp\n"
+    "0000000000000000\t0000000000000006\t.text\tns::Point::sum() const\n"
+    "0000000000000006\t0000000000000004\t.text\ttwice(int)\n"
+    "000000000000000a\t0000000000000009\t.text\tplain\n"
+    "0000000000000000\t0000000000000004\t.data\tcounter\n"
+    "0000000000000013\t0000000000000005\t.text\tcall(double)\n"
+    "0000000000000000\t0000000000000000\t*UND*\texternal(double)\n";
+
+const std::string second_symbols =
+    "0000000000000000\t0000000000000000\t*ABS*\tsecond.cpp\n"
+    "0000000000000000\t000000000000000b\t.text._Z4halfIiET_S0_\t"
+    "int half<int>(int)\n";
+
+} // namespace
+
+TEST_CASE("demangleElf object", "[demangler-elf]") {
+  CHECK(web_demangler::demangleElf(readFile("object.o")) == object_symbols);
+}
+
+TEST_CASE("demangleElf archive", "[demangler-elf]") {
+  CHECK(web_demangler::demangleElf(readFile("archive.a")) ==
+        "\nobject.o:\n" + object_symbols + "\nsecond.o:\n" + second_symbols);
+}
+
+TEST_CASE("demangleElfTo writes each object", "[demangler-elf]") {
+  std::vector<std::string> writes;
+  web_demangler::demangleElfTo(
+      readFile("archive.a"),
+      [&writes](const std::string &output) { writes.push_back(output); });
+  CHECK(writes == std::vector<std::string>{"\nobject.o:\n" + object_symbols,
+                                           "\nsecond.o:\n" + second_symbols});
+}
+
+TEST_CASE("demangleElf invalid", "[demangler-elf]") {
+  CHECK_THROWS_AS(web_demangler::demangleElf("_ZN2ns5Point3sumEv"),
+                  std::runtime_error);
+  CHECK_THROWS_AS(
+      web_demangler::demangleElf(readFile("object.o").substr(0, 80)),
+      std::runtime_error);
+  CHECK_THROWS_AS(
+      web_demangler::demangleElf(readFile("archive.a").substr(0, 100)),
+      std::runtime_error);
+}
@@ -0,0 +1,35 @@
+#include "../native/demangler-formatter.h"
+#include "../native/formatter.h"
+#include <catch2/catch_test_macros.hpp>
+#include <clang/Format/Format.h>
+#include <string>
+
+using web_demangler::demangleAndFormat;
+
+TEST_CASE("demangleAndFormat", "[demangler-formatter]") {
+  const clang::format::FormatStyle style = clang::format::getLLVMStyle();
+
+  CHECK(demangleAndFormat("_Z4halfIiET_S0_", style) == "int half<int>(int)");
+  CHECK(demangleAndFormat(" _Z4halfIiET_S0_\r\n_ZN2ns5Point3sumEv", style) ==
+        "int half<int>(int)\nns::Point::sum()");
+}
+
+TEST_CASE("demangleAndFormat alignment", "[demangler-formatter]") {
+  clang::format::FormatStyle style = clang::format::getLLVMStyle();
+  style.AlignConsecutiveDeclarations.Enabled = true;
+  style.AlignConsecutiveDeclarations.AcrossComments = true;
+
+  // Not "int    half<int>(int)": the names are not aligned with each other.
+  CHECK(demangleAndFormat("_Z4halfIiET_S0_\n_Z4halfIdET_S0_", style) ==
+        "int half<int>(int)\ndouble half<double>(double)");
+}
+
+TEST_CASE("demangleAndFormat fallback", "[demangler-formatter]") {
+  const clang::format::FormatStyle style = clang::format::getLLVMStyle();
+
+  // The unbalanced bracket swallows the separators of the batched pass, so
+  // each name is formatted on its own.
+  CHECK(demangleAndFormat("foo(\n_Z4halfIiET_S0_", style) ==
+        web_formatter::format("foo(", style) + "\n" +
+            web_formatter::format("int half<int>(int)", style));
+}
@@ -0,0 +1,120 @@
+#include "../native/demangler-json.h"
+#include "../native/demangler.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+std::string demangleTo(std::string_view mangled_name) {
+  std::string retval;
+  web_demangler::demangleTo(mangled_name, retval);
+  return retval;
+}
+
+std::string demangleWordsTo(std::string_view text) {
+  std::string retval;
+  web_demangler::demangleWordsTo(text, retval);
+  return retval;
+}
+
+std::vector<std::string> forEachLine(std::string_view text) {
+  std::vector<std::string> retval;
+  web_demangler::forEachLine(
+      text, [&retval](std::string_view line) { retval.emplace_back(line); });
+  return retval;
+}
+
+std::string demangleJsonTo(std::string_view mangled_name) {
+  std::string retval;
+  web_demangler::demangleJsonTo(mangled_name, retval);
+  return retval;
+}
+
+} // namespace
+
+TEST_CASE("demangleTo", "[demangler]") {
+  CHECK(demangleTo("_ZNK2ns5Point3sumEv") == "ns::Point::sum() const");
+  CHECK(demangleTo("_ZN4llvm5errorERKNS_5TwineE") ==
+        "llvm::error(llvm::Twine const&)");
+  CHECK(demangleTo("?f@@YAXXZ") == "void __cdecl f(void)");
+  CHECK(demangleTo("_RNvCs1234_7mycrate3foo") == "mycrate::foo");
+  // Second try with the _Z prefix.
+  CHECK(demangleTo("1fv") == "f()");
+  CHECK(demangleTo("main") == "main");
+  CHECK(demangleTo("") == "");
+
+  std::string output = "prefix ";
+  web_demangler::demangleTo("_Z1fv", output);
+  CHECK(output == "prefix f()");
+}
+
+TEST_CASE("demangleWordsTo", "[demangler]") {
+  CHECK(demangleWordsTo("  _Z1fv\t_ZN2ns7counterE\nmain\n") ==
+        "  f()\tns::counter\nmain\n");
+  // Like c++filt, a word is demangled only if it is a whole symbol and
+  // without the _Z prefix retry of demangleTo.
+  CHECK(demangleWordsTo("_Z1fv, 1fv") == "_Z1fv, 1fv");
+  CHECK(demangleWordsTo("") == "");
+  CHECK(demangleWordsTo(" \r\n") == " \r\n");
+}
+
+TEST_CASE("demangleJsonTo", "[demangler]") {
+  CHECK(demangleJsonTo("_ZNK2ns5Point3sumEv") ==
+        R"~({"mangled":"_ZNK2ns5Point3sumEv",)~"
+        R"~("demangled":"ns::Point::sum() const","kind":"function",)~"
+        R"~("scope":["ns","Point"],"name":"sum","template_args":[],)~"
+        R"~("params":[],"return_type":"","qualifiers":["const"],)~"
+        R"~("ref_qualifier":""})~");
+  CHECK(demangleJsonTo("_Z4halfIiET_S0_") ==
+        R"~({"mangled":"_Z4halfIiET_S0_","demangled":"int half<int>(int)",)~"
+        R"~("kind":"function","scope":[],"name":"half",)~"
+        R"~("template_args":["int"],"params":["int"],"return_type":"int",)~"
+        R"~("qualifiers":[],"ref_qualifier":""})~");
+  CHECK(demangleJsonTo("_ZNKR1A1fEv") ==
+        R"~({"mangled":"_ZNKR1A1fEv","demangled":"A::f() const &",)~"
+        R"~("kind":"function","scope":["A"],"name":"f","template_args":[],)~"
+        R"~("params":[],"return_type":"","qualifiers":["const"],)~"
+        R"~("ref_qualifier":"&"})~");
+  CHECK(demangleJsonTo("_ZN2ns7counterE") ==
+        R"~({"mangled":"_ZN2ns7counterE","demangled":"ns::counter",)~"
+        R"~("kind":"data","scope":["ns"],"name":"counter",)~"
+        R"~("template_args":[]})~");
+  CHECK(demangleJsonTo("_ZTV1A") ==
+        R"~({"mangled":"_ZTV1A","demangled":"vtable for A",)~"
+        R"~("kind":"special"})~");
+  // Second try with the _Z prefix.
+  CHECK(demangleJsonTo("1fv") ==
+        R"~({"mangled":"1fv","demangled":"f()","kind":"function","scope":[],)~"
+        R"~("name":"f","template_args":[],"params":[],"return_type":"",)~"
+        R"~("qualifiers":[],"ref_qualifier":""})~");
+  // Only Itanium symbols are structured.
+  CHECK(demangleJsonTo("?f@@YAXXZ") ==
+        R"~({"mangled":"?f@@YAXXZ","demangled":"void __cdecl f(void)",)~"
+        R"~("kind":"unknown"})~");
+  CHECK(demangleJsonTo("a\"b\\c\x01") ==
+        R"~({"mangled":"a\"b\\c\u0001","demangled":"a\"b\\c\u0001",)~"
+        R"~("kind":"unknown"})~");
+}
+
+TEST_CASE("forEachLine", "[demangler]") {
+  using Lines = std::vector<std::string>;
+  CHECK(forEachLine("_Z1fv\n_Z1gv") == Lines{"_Z1fv", "_Z1gv"});
+  CHECK(forEachLine(" _Z1fv\t\r\n\t_Z1gv \r\n") == Lines{"_Z1fv", "_Z1gv"});
+  // Only the final newline doesn't start a line.
+  CHECK(forEachLine("_Z1fv\n\n \n") == Lines{"_Z1fv", "", ""});
+  CHECK(forEachLine("\n") == Lines{""});
+  CHECK(forEachLine("").empty());
+}
+
+TEST_CASE("demangleJson", "[demangler]") {
+  const std::string f = demangleJsonTo("_Z1fv");
+  const std::string counter = demangleJsonTo("_ZN2ns7counterE");
+  CHECK(web_demangler::demangleJson("_Z1fv\n_ZN2ns7counterE") ==
+        "[" + f + "," + counter + "]");
+  CHECK(web_demangler::demangleJson(" _Z1fv\t\r\n\t_ZN2ns7counterE\r\n") ==
+        "[" + f + "," + counter + "]");
+  CHECK(web_demangler::demangleJson("_Z1fv\n") == "[" + f + "]");
+  CHECK(web_demangler::demangleJson("") == "[]");
+}
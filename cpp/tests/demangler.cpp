@@ -0,0 +1,23 @@
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "../native/demangler-elf.h"
+#include "../native/demangler-json.h"
+#include "../native/demangler.h"
+
+int main() {
+  const std::string input((std::istreambuf_iterator<char>(std::cin)),
+                          std::istreambuf_iterator<char>());
+  web_demangler::demangle(input);
+  std::string output;
+  web_demangler::demangleWordsTo(input, output);
+  web_demangler::demangleJsonTo(input, output);
+  // Inputs that are not a valid ELF object or archive throw.
+  try {
+    web_demangler::demangleElfTo(input, [](const std::string &) {});
+  } catch (const std::runtime_error &) {
+  }
+  return 0;
+}
@@ -0,0 +1,301 @@
+#include "../native/lighten-csv.h"
+#include "../native/lighten-json.h"
+#include "../native/lighten-parallel.h"
+#include "../native/lighten-simd.h"
+#include "../native/lighten-strategy.h"
+#include "../native/lighten-text.h"
+#include "../native/lighten.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("number", "[lighten]") {
+  CHECK(web_lighten::number("1", 4) == "1");
+  CHECK(web_lighten::number("1.", 4) == "1");
+  CHECK(web_lighten::number(".5", 4) == ".5");
+
+  CHECK(web_lighten::number("1.1000175", 4) == "1.1000175");
+  CHECK(web_lighten::number("1.10000165", 4) == "1.1");
+  CHECK(web_lighten::number("11000.0165", 4) == "11000");
+  CHECK(web_lighten::number("11000016.5", 4) == "11000000");
+  CHECK(web_lighten::number("50000001", 4) == "50000000");
+
+  CHECK(web_lighten::number("1.19999165", 4) == "1.2");
+  CHECK(web_lighten::number("11999916.5", 4) == "12000000");
+  CHECK(web_lighten::number("999999", 4) == "1000000");
+  CHECK(web_lighten::number("0.99999", 4) == "1");
+  CHECK(web_lighten::number(".99999", 4) == "1");
+
+  CHECK(web_lighten::number("-1.", 4) == "-1");
+  CHECK(web_lighten::number("-1.10000165", 4) == "-1.1");
+  CHECK(web_lighten::number("-11999916.5", 4) == "-12000000");
+  CHECK(web_lighten::number("-9.9999", 4) == "-10");
+  CHECK(web_lighten::number("+1.99999", 4) == "+2");
+
+  CHECK(web_lighten::number("0.00001", 4) == "0");
+  CHECK(web_lighten::number(".00001", 4) == "0");
+  CHECK(web_lighten::number("-.00001", 4) == "-0");
+}
+
+TEST_CASE("number with exponent", "[lighten]") {
+  CHECK(web_lighten::number("1e5", 4) == "1e5");
+  CHECK(web_lighten::number("1.e5", 4) == "1e5");
+  CHECK(web_lighten::number("1.0000000002e-05", 4) == "1e-05");
+  CHECK(web_lighten::number("-1.19999165E+300", 4) == "-1.2E+300");
+  CHECK(web_lighten::number("0.30000000000000004e1", 4) == "0.3e1");
+
+  // The carry is moved into the exponent.
+  CHECK(web_lighten::number("9.99999e-05", 4) == "1e-04");
+  CHECK(web_lighten::number("9.9999E+09", 4) == "1E+10");
+  CHECK(web_lighten::number("-99.99999e5", 4) == "-1e7");
+  CHECK(web_lighten::number("9.9999e-1", 4) == "1e0");
+  CHECK(web_lighten::number(".99999e5", 4) == "1e5");
+
+  const std::string digits(70, '1');
+  CHECK(web_lighten::number(digits + ".100001e-7", 4) == digits + ".1e-7");
+}
+
+TEST_CASE("number invalid", "[lighten]") {
+  CHECK(web_lighten::number("", 4).empty());
+  CHECK(web_lighten::number("-", 4).empty());
+  CHECK(web_lighten::number(".", 4).empty());
+  CHECK(web_lighten::number("1.2.3", 4).empty());
+  CHECK(web_lighten::number(" 1", 4).empty());
+  CHECK(web_lighten::number("1a", 4).empty());
+  CHECK(web_lighten::number("inf", 4).empty());
+  CHECK(web_lighten::number("nan", 4).empty());
+  CHECK(web_lighten::number("0x1p3", 4).empty());
+  CHECK(web_lighten::number("1e", 4).empty());
+  CHECK(web_lighten::number("1e+", 4).empty());
+  CHECK(web_lighten::number(".e5", 4).empty());
+  CHECK(web_lighten::number("1e5.5", 4).empty());
+  CHECK(web_lighten::number("1e-", 4).empty());
+  CHECK(web_lighten::number("1e+-5", 4).empty());
+  CHECK(web_lighten::number("1x5", 4).empty());
+  CHECK(web_lighten::number(std::string("1.10000\0a", 9), 4) == "1.1");
+
+  CHECK_THROWS_AS(web_lighten::number("1", 0), std::runtime_error);
+  CHECK_THROWS_AS(web_lighten::number("1", 10), std::runtime_error);
+}
+
+TEST_CASE("parseNumber", "[lighten]") {
+  web_lighten::NumberParts parts{};
+  REQUIRE(web_lighten::parseNumber("-12.34e-5", parts));
+  CHECK(parts.integer == 1);
+  CHECK(parts.integer_end == 3);
+  CHECK(parts.fraction == 4);
+  CHECK(parts.exponent == 6);
+
+  REQUIRE(web_lighten::parseNumber("12", parts));
+  CHECK(parts.integer == 0);
+  CHECK(parts.integer_end == 2);
+  CHECK(parts.fraction == 2);
+  CHECK(parts.exponent == 2);
+
+  REQUIRE(web_lighten::parseNumber("+.5E3", parts));
+  CHECK(parts.integer == 1);
+  CHECK(parts.integer_end == 1);
+  CHECK(parts.fraction == 2);
+  CHECK(parts.exponent == 3);
+
+  CHECK(web_lighten::parseNumber("1.", parts));
+  CHECK_FALSE(web_lighten::parseNumber("", parts));
+  CHECK_FALSE(web_lighten::parseNumber("+", parts));
+  CHECK_FALSE(web_lighten::parseNumber("--1", parts));
+  CHECK_FALSE(web_lighten::parseNumber("1.2.3", parts));
+  CHECK_FALSE(web_lighten::parseNumber("1e5.5", parts));
+  CHECK_FALSE(web_lighten::parseNumber("1 ", parts));
+}
+
+TEST_CASE("numberTo", "[lighten]") {
+  const std::string_view num = "-99.99999";
+  std::string output(web_lighten::numberMaxLength(num.size()) + 1, '#');
+  const size_t length = web_lighten::numberTo(num, 4, output.data());
+  CHECK(length == 4);
+  CHECK(std::string_view(output.data(), length) == "-100");
+  CHECK(output.back() == '#');
+
+  const std::string_view carry = "99999";
+  output.assign(web_lighten::numberMaxLength(carry.size()), '#');
+  CHECK(web_lighten::numberTo(carry, 4, output.data()) == output.size());
+  CHECK(output == "100000");
+}
+
+TEST_CASE("json", "[lighten]") {
+  CHECK(web_lighten::json("", 4).empty());
+  CHECK(web_lighten::json("[0.30000000000000004, -1.19999165]", 4) ==
+        "[0.3, -1.2]");
+  CHECK(web_lighten::json("{\n  \"b\": 1.10000165,\n  \"a\": [true]\n}", 4) ==
+        "{\n  \"b\": 1.1,\n  \"a\": [true]\n}");
+  CHECK(web_lighten::json(R"({"1.10000165": "\"0.99999", "y": 999999})", 4) ==
+        R"({"1.10000165": "\"0.99999", "y": 1000000})");
+  CHECK(web_lighten::json("[1e5, -, 2, 1.0000001e-7]", 4) ==
+        "[1e5, -, 2, 1e-7]");
+}
+
+TEST_CASE("jsonTo write", "[lighten]") {
+  std::string input;
+  for (size_t i = 0; i < 200; ++i) {
+    input += R"({"a": 1.10000165, "b\"1.5": [-0.30000000000000004, "x"]},)";
+  }
+  const std::string expected = web_lighten::json(input, 4);
+  for (const size_t chunk_size : {1, 7, 100, 100000}) {
+    std::string output;
+    size_t writes = 0;
+    web_lighten::jsonTo(input, 4, chunk_size,
+                        [&output, &writes](const std::string &chunk) {
+                          output += chunk;
+                          ++writes;
+                        });
+    CHECK(output == expected);
+    CHECK(writes >= expected.size() / (chunk_size + 20));
+  }
+}
+
+TEST_CASE("text", "[lighten]") {
+  CHECK(web_lighten::text("", 4).empty());
+  CHECK(web_lighten::text("a 1.10000165 b\n-0.99999;", 4) == "a 1.1 b\n-1;");
+  CHECK(web_lighten::text("x1.10000165 1.10000165px v2.0000001.3", 4) ==
+        "x1.10000165 1.10000165px v2.0000001.3");
+  CHECK(web_lighten::text("2024-01-05 . - 1.0000001e-7.", 4) ==
+        "2024-01-05 . - 1.0000001e-7.");
+  CHECK(web_lighten::text("(0.30000000000000004,9.99999e4)", 4) ==
+        "(0.3,1e5)");
+}
+
+TEST_CASE("text parallel", "[lighten]") {
+  std::mt19937 generator(42);
+  const std::string_view chars = "0123456789.-e x\n";
+  std::string input(10000, '\0');
+  for (char &c : input) {
+    c = chars[generator() % chars.size()];
+  }
+  const std::string expected = web_lighten::text(input, 4);
+
+  for (const size_t threads : {1, 2, 8}) {
+    std::string output;
+    web_lighten::textParallel(
+        input, 4, threads, 100,
+        [&output](const std::string &chunk) { output += chunk; });
+    CHECK(output == expected);
+  }
+}
+
+TEST_CASE("classify", "[lighten]") {
+  std::mt19937 generator(42);
+  const std::string_view chars = "0123456789.-+e ";
+  std::string block(web_lighten::block_size, '\0');
+  for (size_t i = 0; i < 1000; ++i) {
+    for (char &c : block) {
+      c = chars[generator() % chars.size()];
+    }
+    const size_t length = generator() % (block.size() + 1);
+    const web_lighten::CharClasses scalar =
+        web_lighten::classifyScalar(block.data(), length);
+    const web_lighten::CharClasses simd =
+        web_lighten::classify(block.data(), length);
+    CHECK(scalar.digits == simd.digits);
+    CHECK(scalar.zeros == simd.zeros);
+    CHECK(scalar.nines == simd.nines);
+    CHECK(scalar.dots == simd.dots);
+  }
+
+  CHECK(web_lighten::findRuns(0b0111'1011, 3) == 0b0001'1000);
+  CHECK(web_lighten::removeBit(0b1011, 2) == 0b111);
+}
+
+TEST_CASE("number longer than a block", "[lighten]") {
+  const std::string digits(70, '1');
+  CHECK(web_lighten::number(digits, 4) == digits);
+  CHECK(web_lighten::number("0." + digits + "00001", 4) == "0." + digits);
+  CHECK(web_lighten::number(digits + ".199999", 4) == digits + ".2");
+}
+
+TEST_CASE("csv", "[lighten]") {
+  const std::string input = "a,b,\"c,\"\"1.10000165\"\"\"\r\n"
+                            "0.30000000000000004,1.19999165,\"0.1000001\"\r\n"
+                            "2.00000001,x,3\n"
+                            "7.0000001";
+  CHECK(web_lighten::csv(input, ',', {}, 4) ==
+        "a,b,\"c,\"\"1.10000165\"\"\"\r\n"
+        "0.3,1.2,\"0.1000001\"\r\n"
+        "2,x,3\n"
+        "7");
+  const std::string column_two = "a,b,\"c,\"\"1.10000165\"\"\"\r\n"
+                                 "0.30000000000000004,1.2,\"0.1000001\"\r\n"
+                                 "2.00000001,x,3\n"
+                                 "7.0000001";
+  CHECK(web_lighten::csv(input, ',', {0, 4}, 0) == column_two);
+
+  // The result must not depend on how the input is cut.
+  for (size_t i = 0; i <= input.size(); ++i) {
+    web_lighten::CsvLightener lightener(',', {0, 4});
+    std::string output;
+    lightener.feed(std::string_view(input).substr(0, i), output);
+    lightener.feed(std::string_view(input).substr(i), output);
+    lightener.finish(output);
+    CHECK(output == column_two);
+  }
+
+  CHECK(web_lighten::csv("1.10000165\t1.10000165", '\t', {}, 4) ==
+        "1.1\t1.1");
+}
+
+TEST_CASE("strategy", "[lighten]") {
+  using web_lighten::Strategy;
+
+  CHECK(web_lighten::lightenBatch("0.30000000000000004\n1.19999165\n+1.\nx",
+                                  '\n', Strategy::Runs, 4) ==
+        "0.3\n1.2\n+1\nx");
+  CHECK(web_lighten::lightenBatch("0.30000000000000004,0.1000000000000000055",
+                                  ',', Strategy::ShortestDouble, 0) ==
+        "0.30000000000000004,0.1");
+  CHECK(web_lighten::lightenBatch("0.30000000000000004,0.100000001490116,+2",
+                                  ',', Strategy::ShortestFloat, 0) ==
+        "0.3,0.1,2");
+  CHECK(web_lighten::lightenBatch("3.14159265,-1234567,1e-7,", ',',
+                                  Strategy::Precision, 4) ==
+        "3.142,-1.235e+06,1e-07,");
+  CHECK_THROWS_AS(web_lighten::lightenBatch("1", ',', Strategy::Precision, 18),
+                  std::runtime_error);
+
+  const std::string_view num = "1e5";
+  std::string output(web_lighten::lightenMaxLength(num.size()), '\0');
+  output.resize(web_lighten::lightenTo(num, Strategy::ShortestDouble, 0,
+                                       output.data()));
+  CHECK(output == "1e+05");
+}
+
+TEST_CASE("batch", "[lighten]") {
+  using web_lighten::Strategy;
+
+  std::vector<double> doubles{0.1 + 0.2, 1.19999165, -999999., 1e-7};
+  web_lighten::lightenValues(doubles.data(), doubles.size(), Strategy::Runs, 4,
+                             doubles.data());
+  CHECK(doubles == std::vector<double>{0.3, 1.2, -1000000., 1e-7});
+
+  const std::vector<float> floats{1.10000165F, 3.14159265F};
+  std::vector<float> lighten_floats(floats.size());
+  web_lighten::lightenValues(floats.data(), floats.size(), Strategy::Precision,
+                             3, lighten_floats.data());
+  CHECK(lighten_floats == std::vector<float>{1.1F, 3.14F});
+
+  const std::string_view packed = "1.10000165x0.999999-5";
+  const std::vector<uint32_t> offsets{0, 10, 11, 19, 21};
+  std::string output = "#";
+  std::vector<uint32_t> output_offsets;
+  web_lighten::lightenPackedTo(packed, offsets.data(), offsets.size() - 1,
+                               Strategy::Runs, 4, output, output_offsets);
+  CHECK(output == "#1.1x1-5");
+  CHECK(output_offsets == std::vector<uint32_t>{1, 4, 5, 6, 8});
+
+  const std::vector<uint32_t> invalid{0, 30};
+  CHECK_THROWS_AS(web_lighten::lightenPackedTo(packed, invalid.data(), 1,
+                                               Strategy::Runs, 4, output,
+                                               output_offsets),
+                  std::runtime_error);
+}
@@ -0,0 +1,70 @@
+#include "../native/mapped-file.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+// Write data to a pipe from another thread and read it back as
+// /dev/fd/<read end>, like demangler_cli <(...).
+std::string readPipe(const std::string &data) {
+  int fds[2];
+  REQUIRE(pipe(fds) == 0);
+  std::thread writer([&data, fd = fds[1]]() {
+    size_t written = 0;
+    while (written < data.size()) {
+      const ssize_t count =
+          write(fd, data.data() + written, data.size() - written);
+      if (count <= 0) {
+        break;
+      }
+      written += static_cast<size_t>(count);
+    }
+    close(fd);
+  });
+  std::string retval;
+  {
+    const web_utils::MappedFile file("/dev/fd/" + std::to_string(fds[0]));
+    retval = file.view();
+  }
+  writer.join();
+  close(fds[0]);
+  return retval;
+}
+
+} // namespace
+
+TEST_CASE("MappedFile regular file", "[mapped-file]") {
+  const std::string path = "mapped-file.txt";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "_Z1fv\n_Z1gv\n";
+  }
+  {
+    const web_utils::MappedFile file(path);
+    CHECK(file.view() == "_Z1fv\n_Z1gv\n");
+  }
+  std::remove(path.c_str());
+}
+
+TEST_CASE("MappedFile pipe", "[mapped-file]") {
+  CHECK(readPipe("").empty());
+  CHECK(readPipe("hello world\n") == "hello world\n");
+  // More than the pipe buffer and the read blocks.
+  std::string large;
+  for (size_t i = 0; large.size() < 3 * 1024 * 1024; i++) {
+    large += std::to_string(i);
+    large += '\n';
+  }
+  CHECK(readPipe(large) == large);
+}
+
+TEST_CASE("MappedFile missing file", "[mapped-file]") {
+  CHECK_THROWS_AS(web_utils::MappedFile("missing/mapped-file.txt"),
+                  std::runtime_error);
+}
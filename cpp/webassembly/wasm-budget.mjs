@@ -0,0 +1,386 @@
+// Size and startup budget of the wasm modules.
+//
+// Usage: node wasm-budget.mjs [--output budget.json] [--baseline old.json]
+//                             [--iterations count] [--corpus dir] [module]...
+//
+// Each module is the basename of an emscripten output (web_formatter for
+// web_formatter.js and web_formatter.wasm) in the current directory. The
+// report has, for each module, the size of the .wasm and .js, the size of
+// every wasm section, the compile and instantiate time and the latency of the
+// first call of each exported function. If twiggy is in the PATH, its top
+// items are added. With a baseline, the growth of the wasm is also printed.
+// Without --baseline, the previous report in the output file is the baseline.
+// With --iterations, each function is called count more times after the first
+// call and the median is the steady call time. The speedup of each function
+// against the baseline is then added to compare optimization profiles.
+// With --corpus (cpp/tests/data), the workloads of bench_demangler and
+// bench_lighten are also timed on their corpora (median of count runs, 5 by
+// default), with their speedup against the baseline.
+
+import { execFileSync } from 'node:child_process';
+import { existsSync, readFileSync, statSync, writeFileSync } from 'node:fs';
+import { resolve } from 'node:path';
+import { performance } from 'node:perf_hooks';
+import { pathToFileURL } from 'node:url';
+
+const defaultModules = [
+  'web_demangler',
+  'web_formatter',
+  'web_lighten',
+  'web_clang_format_config_migrate',
+];
+
+const sectionNames = [
+  'custom',
+  'type',
+  'import',
+  'function',
+  'table',
+  'memory',
+  'global',
+  'export',
+  'start',
+  'element',
+  'code',
+  'data',
+  'data_count',
+  'tag',
+];
+
+// Release the embind objects returned by a call.
+function release(value) {
+  if (value !== null && typeof value === 'object' && 'delete' in value) {
+    value.delete();
+  }
+}
+
+// First call of each exported function with a small input.
+const firstCalls = {
+  web_demangler: {
+    web_demangle: (m) => m.web_demangle('_ZN4llvm5errorERKNS_5TwineE'),
+    web_demangle_json: (m) =>
+      m.web_demangle_json('_ZN4llvm5errorERKNS_5TwineE\n_Z1fv'),
+    web_demangle_batch: (m) =>
+      m.web_demangle_batch(
+        new TextEncoder().encode('_ZN4llvm5errorERKNS_5TwineE_Z1fv'),
+        new Uint32Array([0, 27, 32]),
+      ),
+  },
+  web_formatter: {
+    getLLVMStyle: (m) => m.getLLVMStyle(),
+    deserializeFromYaml: (m) => m.deserializeFromYaml('BasedOnStyle: LLVM'),
+    formatter: (m) => {
+      const style = m.getLLVMStyle();
+      const retval = m.formatter('int  main( ){return 0;}', style);
+      style.delete();
+      return retval;
+    },
+    demangleAndFormat: (m) => {
+      const style = m.getLLVMStyle();
+      const retval = m.demangleAndFormat('_ZN4llvm5errorERKNS_5TwineE', style);
+      style.delete();
+      return retval;
+    },
+  },
+  web_lighten: {
+    web_lighten_number: (m) => m.web_lighten_number('0.30000000000000004', 3),
+    web_lighten_text: (m) => m.web_lighten_text('1.2999999 and 4.5000001', 3),
+    web_lighten_json: (m) => m.web_lighten_json('{"a":[1.0000001,2.9999]}', 3),
+    web_lighten_float64_array: (m) =>
+      m.web_lighten_float64_array(
+        new Float64Array([0.1 + 0.2, 1 / 3]),
+        m.Strategy.ShortestDouble,
+        3,
+      ),
+  },
+  web_clang_format_config_migrate: {
+    getCompatibleVersion: (m) => m.getCompatibleVersion('ColumnLimit: 100'),
+    getStyleNames: (m) => m.getStyleNames(m.Version.V21),
+    migrateTo: (m) =>
+      m.migrateTo(
+        m.Version.V3_5,
+        m.Version.V21,
+        'ColumnLimit: 100',
+        'LLVM',
+        true,
+      ),
+  },
+};
+
+// The optional module with the demangler and the formatter.
+firstCalls.web_demangler_formatter = {
+  ...firstCalls.web_demangler,
+  ...firstCalls.web_formatter,
+};
+
+// Items as a packed batch: UTF-8 text and count + 1 byte offsets.
+function pack(items) {
+  const encoder = new TextEncoder();
+  const encoded = items.map((item) => encoder.encode(item));
+  const offsets = new Uint32Array(items.length + 1);
+  for (let i = 0; i < encoded.length; i++) {
+    offsets[i + 1] = offsets[i] + encoded[i].length;
+  }
+  const text = new Uint8Array(offsets[items.length]);
+  encoded.forEach((item, i) => {
+    text.set(item, offsets[i]);
+  });
+  return { text, offsets };
+}
+
+// Workloads on the corpora of cpp/tests/data, named like the results of
+// bench_demangler and bench_lighten.
+const corpusCalls = {
+  web_demangler: (directory) => {
+    const calls = {};
+    for (const name of ['itanium', 'msvc', 'rust']) {
+      const text = readFileSync(
+        resolve(directory, 'demangler', `${name}.txt`),
+        'utf8',
+      );
+      const symbols = text.split('\n').filter((line) => line !== '');
+      const batch = pack(symbols);
+      calls[`${name}/demangle`] = (m) => {
+        for (const symbol of symbols) {
+          m.web_demangle(symbol);
+        }
+      };
+      calls[`${name}/demangleBatch`] = (m) =>
+        m.web_demangle_batch(batch.text, batch.offsets);
+      calls[`${name}/demangleJson`] = (m) => m.web_demangle_json(text);
+    }
+    return calls;
+  },
+  web_lighten: (directory) => {
+    const read = (name) =>
+      readFileSync(resolve(directory, 'lighten', name), 'utf8');
+    const decimals = read('decimals.txt');
+    const telemetry = read('telemetry.json');
+    const measures = read('measures.csv');
+    const newline = '\n'.charCodeAt(0);
+    return {
+      'decimals.txt/text': (m) => m.web_lighten_text(decimals, 4),
+      'decimals.txt/lightenBatch/Runs': (m) =>
+        m.web_lighten_batch(decimals, newline, m.Strategy.Runs, 4),
+      'decimals.txt/lightenBatch/ShortestDouble': (m) =>
+        m.web_lighten_batch(decimals, newline, m.Strategy.ShortestDouble, 0),
+      'telemetry.json/text': (m) => m.web_lighten_text(telemetry, 4),
+      'telemetry.json/json': (m) => m.web_lighten_json(telemetry, 4),
+      'measures.csv/text': (m) => m.web_lighten_text(measures, 4),
+      'measures.csv/csv': (m) => {
+        const sizes = new m.SizeList();
+        const retval = m.web_lighten_csv(
+          measures,
+          ','.charCodeAt(0),
+          sizes,
+          4,
+        );
+        sizes.delete();
+        return retval;
+      },
+    };
+  },
+};
+corpusCalls.web_demangler_formatter = corpusCalls.web_demangler;
+
+function readSections(bytes) {
+  const sections = [];
+  const readLeb = (offset) => {
+    let value = 0;
+    let shift = 0;
+    let byte;
+    do {
+      byte = bytes[offset++];
+      value += (byte & 0x7f) * 2 ** shift;
+      shift += 7;
+    } while (byte & 0x80);
+    return { value, offset };
+  };
+
+  // Skip magic number and version.
+  let offset = 8;
+  while (offset < bytes.length) {
+    const id = bytes[offset];
+    const size = readLeb(offset + 1);
+    let name = sectionNames[id] ?? `unknown_${id}`;
+    if (id === 0) {
+      const length = readLeb(size.offset);
+      name = `custom:${Buffer.from(
+        bytes.subarray(length.offset, length.offset + length.value),
+      ).toString()}`;
+    }
+    sections.push({ name, bytes: size.offset - offset + size.value });
+    offset = size.offset + size.value;
+  }
+  return sections;
+}
+
+function twiggyTop(wasm) {
+  try {
+    const output = execFileSync(
+      'twiggy',
+      ['top', '-n', '20', '-f', 'json', wasm],
+      { encoding: 'utf8', stdio: ['ignore', 'pipe', 'ignore'] },
+    );
+    return JSON.parse(output);
+  } catch {
+    return undefined;
+  }
+}
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+}
+
+async function measure(name, iterations, corpus) {
+  const wasm = resolve(`${name}.wasm`);
+  const js = resolve(`${name}.js`);
+  const bytes = readFileSync(wasm);
+
+  const report = {
+    name,
+    wasm_bytes: bytes.length,
+    js_bytes: statSync(js).size,
+    sections: readSections(bytes),
+  };
+
+  let start = performance.now();
+  const module = await WebAssembly.compile(bytes);
+  report.compile_ms = performance.now() - start;
+
+  const factory = (await import(pathToFileURL(js).href)).default;
+  start = performance.now();
+  // The glue waits for receive forever: a failed instantiation must reject
+  // on its own.
+  let instantiateFailed;
+  const failure = new Promise((_, reject) => {
+    instantiateFailed = reject;
+  });
+  const instance = await Promise.race([
+    factory({
+      // The modules are built for the web: give the compiled module instead
+      // of letting the glue fetch it.
+      instantiateWasm: (imports, receive) => {
+        WebAssembly.instantiate(module, imports)
+          .then((result) => {
+            receive(result, module);
+          })
+          .catch(instantiateFailed);
+        return {};
+      },
+    }),
+    failure,
+  ]);
+  report.instantiate_ms = performance.now() - start;
+
+  report.first_call_ms = {};
+  if (iterations > 0) {
+    report.call_ms = {};
+  }
+  for (const [fn, call] of Object.entries(firstCalls[name] ?? {})) {
+    start = performance.now();
+    const result = call(instance);
+    report.first_call_ms[fn] = performance.now() - start;
+    release(result);
+
+    if (iterations > 0) {
+      const times = [];
+      for (let i = 0; i < iterations; i++) {
+        start = performance.now();
+        release(call(instance));
+        times.push(performance.now() - start);
+      }
+      report.call_ms[fn] = median(times);
+    }
+  }
+
+  if (corpus !== undefined && name in corpusCalls) {
+    report.corpus_ms = {};
+    const calls = corpusCalls[name](corpus);
+    for (const [workload, call] of Object.entries(calls)) {
+      // The first run is the warm up.
+      release(call(instance));
+      const times = [];
+      for (let i = 0; i < (iterations > 0 ? iterations : 5); i++) {
+        start = performance.now();
+        release(call(instance));
+        times.push(performance.now() - start);
+      }
+      report.corpus_ms[workload] = median(times);
+    }
+  }
+
+  const twiggy = twiggyTop(wasm);
+  if (twiggy !== undefined) {
+    report.twiggy_top = twiggy;
+  }
+  return report;
+}
+
+const args = process.argv.slice(2);
+let output;
+let baseline;
+let iterations = 0;
+let corpus;
+const modules = [];
+for (let i = 0; i < args.length; i++) {
+  if (args[i] === '--output') {
+    output = args[++i];
+  } else if (args[i] === '--baseline') {
+    baseline = JSON.parse(readFileSync(args[++i], 'utf8'));
+  } else if (args[i] === '--iterations') {
+    iterations = Number(args[++i]);
+  } else if (args[i] === '--corpus') {
+    corpus = resolve(args[++i]);
+  } else {
+    modules.push(args[i]);
+  }
+}
+if (baseline === undefined && output !== undefined && existsSync(output)) {
+  baseline = JSON.parse(readFileSync(output, 'utf8'));
+}
+
+const reports = [];
+for (const name of modules.length === 0 ? defaultModules : modules) {
+  const report = await measure(name, iterations, corpus);
+  const previous = baseline?.modules.find((item) => item.name === name);
+  let summary = '';
+  if (previous !== undefined) {
+    report.baseline_wasm_bytes = previous.wasm_bytes;
+    report.wasm_growth = report.wasm_bytes / previous.wasm_bytes;
+    summary += `, size x${report.wasm_growth.toFixed(3)}`;
+    if (report.call_ms !== undefined && previous.call_ms !== undefined) {
+      report.call_speedup = {};
+      for (const [fn, ms] of Object.entries(report.call_ms)) {
+        if (previous.call_ms[fn] !== undefined) {
+          report.call_speedup[fn] = previous.call_ms[fn] / ms;
+          summary += `, ${fn} x${report.call_speedup[fn].toFixed(2)}`;
+        }
+      }
+    }
+    if (report.corpus_ms !== undefined && previous.corpus_ms !== undefined) {
+      report.corpus_speedup = {};
+      for (const [workload, ms] of Object.entries(report.corpus_ms)) {
+        if (previous.corpus_ms[workload] !== undefined) {
+          const speedup = previous.corpus_ms[workload] / ms;
+          report.corpus_speedup[workload] = speedup;
+          summary += `, ${workload} x${speedup.toFixed(2)}`;
+        }
+      }
+    }
+  }
+  reports.push(report);
+  console.error(
+    `${name}: ${report.wasm_bytes} B wasm, ${report.js_bytes} B js, ` +
+      `compile ${report.compile_ms.toFixed(1)} ms, ` +
+      `instantiate ${report.instantiate_ms.toFixed(1)} ms${summary}`,
+  );
+}
+
+const json = `${JSON.stringify({ modules: reports }, null, 2)}\n`;
+if (output === undefined) {
+  process.stdout.write(json);
+} else {
+  writeFileSync(output, json);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <emscripten/val.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace web_batch {
+
+// Run fn(item, output) on every item of a packed batch. text is the UTF-8 of
+// the items (an Uint8Array on the JS side) and offsets an Uint32Array of
+// count + 1 byte offsets in text. fn appends the result of item to output.
+//
+// Return {text, offsets} with the same layout: text is an Uint8Array and
+// offsets an Uint32Array. Both are copied out of the wasm memory so a worker
+// can transfer their buffer to the main thread.
+template <typename F>
+emscripten::val run(const std::string &text, const emscripten::val &offsets,
+                    F fn) {
+  const std::vector<uint32_t> input_offsets =
+      emscripten::convertJSArrayToNumberVector<uint32_t>(offsets);
+  for (size_t i = 1; i < input_offsets.size(); ++i) {
+    if (input_offsets[i] < input_offsets[i - 1] ||
+        input_offsets[i] > text.size()) {
+      throw std::invalid_argument("Invalid offsets of batch.");
+    }
+  }
+
+  std::string output;
+  std::vector<uint32_t> output_offsets;
+  output_offsets.reserve(input_offsets.size());
+  const std::string_view view = text;
+  for (size_t i = 0; i + 1 < input_offsets.size(); ++i) {
+    output_offsets.push_back(static_cast<uint32_t>(output.size()));
+    fn(view.substr(input_offsets[i], input_offsets[i + 1] - input_offsets[i]),
+       output);
+  }
+  if (!input_offsets.empty()) {
+    output_offsets.push_back(static_cast<uint32_t>(output.size()));
+  }
+
+  emscripten::val retval = emscripten::val::object();
+  retval.set("text", emscripten::val::global("Uint8Array")
+                         .new_(emscripten::typed_memory_view(
+                             output.size(),
+                             reinterpret_cast<const uint8_t *>(
+                                 output.data()))));
+  retval.set("offsets", emscripten::val::global("Uint32Array")
+                            .new_(emscripten::typed_memory_view(
+                                output_offsets.size(), output_offsets.data())));
+  return retval;
+}
+
+} // namespace web_batch
@@ -1,7 +1,29 @@
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
+#include <string>
+#include <string_view>
 
+#include "../native/demangler-elf.h"
+#include "../native/demangler-json.h"
 #include "../native/demangler.h"
+#include "web-batch.h"
+
+namespace {
+
+// Demangle every item of a packed batch (see web_batch::run).
+emscripten::val demangleBatch(const std::string &text,
+                              const emscripten::val &offsets) {
+  return web_batch::run(text, offsets,
+                        [](std::string_view item, std::string &output) {
+                          web_demangler::demangleTo(item, output);
+                        });
+}
+
+} // namespace
 
 EMSCRIPTEN_BINDINGS(web_demangler) {
   emscripten::function("web_demangle", &web_demangler::demangle);
+  emscripten::function("web_demangle_batch", &demangleBatch);
+  emscripten::function("web_demangle_elf", &web_demangler::demangleElf);
+  emscripten::function("web_demangle_json", &web_demangler::demangleJson);
 }
@@ -3,14 +3,18 @@
 #include <clang/Tooling/Core/Replacement.h>
 #include <clang/Tooling/Inclusions/IncludeStyle.h>
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
 #include <llvm/ADT/ArrayRef.h> // IWYU pragma: keep
 #include <llvm/Support/Error.h>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <type_traits>
 
+#include "../native/demangler-formatter.h"
 #include "../native/formatter.h"
+#include "web-batch.h"
 
 namespace web_formatter {
 
@@ -41,12 +45,38 @@ void registerFormatStyle() {
 #include "web-formatter-binding.cpp.inc" // IWYU pragma: keep
 }
 
+// Format every item of a packed batch (see web_batch::run) with the same
+// style.
+emscripten::val formatBatch(const std::string &text,
+                            const emscripten::val &offsets,
+                            const clang::format::FormatStyle &format_style) {
+  return web_batch::run(
+      text, offsets, [&](std::string_view item, std::string &output) {
+        output += format(std::string(item), format_style);
+      });
+}
+
+emscripten::val
+demangleAndFormatBatch(const std::string &text, const emscripten::val &offsets,
+                       const clang::format::FormatStyle &format_style) {
+  return web_batch::run(
+      text, offsets, [&](std::string_view item, std::string &output) {
+        output +=
+            web_demangler::demangleAndFormat(std::string(item), format_style);
+      });
+}
+
 } // namespace
 
 } // namespace web_formatter
 
 EMSCRIPTEN_BINDINGS(web_formatter) {
   emscripten::function("formatter", &web_formatter::format);
+  emscripten::function("demangleAndFormat",
+                       &web_demangler::demangleAndFormat);
+  emscripten::function("formatterBatch", &web_formatter::formatBatch);
+  emscripten::function("demangleAndFormatBatch",
+                       &web_formatter::demangleAndFormatBatch);
   emscripten::register_vector<std::string>("StringList");
   emscripten::register_vector<clang::tooling::IncludeStyle::IncludeCategory>(
       "IncludeCategoryList");
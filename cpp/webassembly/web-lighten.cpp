@@ -1,7 +1,112 @@
+#include <cstdint>
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
+#include <string>
+#include <string_view>
+#include <vector>
 
+#include "../native/lighten-csv.h"
+#include "../native/lighten-json.h"
+#include "../native/lighten-strategy.h"
+#include "../native/lighten-text.h"
 #include "../native/lighten.h"
+#include "web-batch.h"
+
+namespace {
+
+std::string csvFeed(web_lighten::CsvLightener &lightener,
+                    const std::string &chunk) {
+  std::string retval;
+  lightener.feed(chunk, retval);
+  return retval;
+}
+
+std::string csvFinish(web_lighten::CsvLightener &lightener) {
+  std::string retval;
+  lightener.finish(retval);
+  return retval;
+}
+
+// Copy the typed array in the wasm memory, lighten it in place and copy it
+// back in a new typed array of the same type.
+template <typename T>
+emscripten::val lightenTypedArray(const emscripten::val &values,
+                                  web_lighten::Strategy strategy, size_t size,
+                                  const char *type) {
+  std::vector<T> buffer = emscripten::convertJSArrayToNumberVector<T>(values);
+  web_lighten::lightenValues(buffer.data(), buffer.size(), strategy, size,
+                             buffer.data());
+  return emscripten::val::global(type).new_(
+      emscripten::typed_memory_view(buffer.size(), buffer.data()));
+}
+
+emscripten::val lightenFloat64Array(const emscripten::val &values,
+                                    web_lighten::Strategy strategy,
+                                    size_t size) {
+  return lightenTypedArray<double>(values, strategy, size, "Float64Array");
+}
+
+emscripten::val lightenFloat32Array(const emscripten::val &values,
+                                    web_lighten::Strategy strategy,
+                                    size_t size) {
+  return lightenTypedArray<float>(values, strategy, size, "Float32Array");
+}
+
+// offsets is an Uint32Array of count + 1 offsets in text. Return
+// {text, offsets} with the same layout.
+emscripten::val lightenPacked(const std::string &text,
+                              const emscripten::val &offsets,
+                              web_lighten::Strategy strategy, size_t size) {
+  const std::vector<uint32_t> input_offsets =
+      emscripten::convertJSArrayToNumberVector<uint32_t>(offsets);
+  std::string output;
+  std::vector<uint32_t> output_offsets;
+  if (!input_offsets.empty()) {
+    web_lighten::lightenPackedTo(text, input_offsets.data(),
+                                 input_offsets.size() - 1, strategy, size,
+                                 output, output_offsets);
+  }
+
+  emscripten::val retval = emscripten::val::object();
+  retval.set("text", output);
+  retval.set("offsets", emscripten::val::global("Uint32Array")
+                            .new_(emscripten::typed_memory_view(
+                                output_offsets.size(), output_offsets.data())));
+  return retval;
+}
+
+// Lighten every JSON document of a packed batch (see web_batch::run).
+emscripten::val lightenJsonBatch(const std::string &text,
+                                 const emscripten::val &offsets,
+                                 size_t size) {
+  return web_batch::run(text, offsets,
+                        [size](std::string_view item, std::string &output) {
+                          web_lighten::jsonTo(item, size, output);
+                        });
+}
+
+} // namespace
 
 EMSCRIPTEN_BINDINGS(web_lighten) {
   emscripten::function("web_lighten_number", &web_lighten::number);
+  emscripten::function("web_lighten_json", &web_lighten::json);
+  emscripten::function("web_lighten_json_batch", &lightenJsonBatch);
+  emscripten::function("web_lighten_text", &web_lighten::text);
+
+  emscripten::enum_<web_lighten::Strategy>("Strategy")
+      .value("Runs", web_lighten::Strategy::Runs)
+      .value("ShortestDouble", web_lighten::Strategy::ShortestDouble)
+      .value("ShortestFloat", web_lighten::Strategy::ShortestFloat)
+      .value("Precision", web_lighten::Strategy::Precision);
+  emscripten::function("web_lighten_batch", &web_lighten::lightenBatch);
+  emscripten::function("web_lighten_float64_array", &lightenFloat64Array);
+  emscripten::function("web_lighten_float32_array", &lightenFloat32Array);
+  emscripten::function("web_lighten_packed", &lightenPacked);
+
+  emscripten::register_vector<size_t>("SizeList");
+  emscripten::function("web_lighten_csv", &web_lighten::csv);
+  emscripten::class_<web_lighten::CsvLightener>("CsvLightener")
+      .constructor<char, std::vector<size_t>, size_t>()
+      .function("feed", &csvFeed)
+      .function("finish", &csvFinish);
 }